@@ -0,0 +1,206 @@
+#pragma once
+#include "vector.h"
+#include "vector_instrumentation.h"
+
+#include <atomic>
+#include <cstddef>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//    AdaptiveVector    .   
+//      ,      
+class CapacityHints
+{
+public:
+    //  visitor(name, hint)   ,       
+    template <typename Visitor>
+    static void ForEach(Visitor&& visitor)
+    {
+        std::vector<Entry> entries;
+        {
+            std::lock_guard lock(Mutex());
+            entries = Entries();
+        }
+        for (const Entry& entry : entries)
+        {
+            visitor(entry.name, entry.hint->load(std::memory_order_relaxed));
+        }
+    }
+
+    //    " "
+    static void Save(std::ostream& out)
+    {
+        ForEach([&out](std::string_view name, size_t hint) {
+            out << hint << ' ' << name << '\n';
+            });
+    }
+
+    //     Save.  ,     ,
+    //     
+    static void Load(std::istream& in)
+    {
+        size_t hint = 0;
+        std::string name;
+        while (in >> hint && in.get() == ' ' && std::getline(in, name))
+        {
+            std::lock_guard lock(Mutex());
+            bool applied = false;
+            for (const Entry& entry : Entries())
+            {
+                if (entry.name == name)
+                {
+                    entry.hint->store(hint, std::memory_order_relaxed);
+                    applied = true;
+                }
+            }
+            if (!applied)
+            {
+                Pending()[name] = hint;
+            }
+        }
+    }
+
+    //          
+    static void Register(std::string_view name, std::atomic<size_t>* hint)
+    {
+        std::lock_guard lock(Mutex());
+        Entries().push_back(Entry{ name, hint });
+        const auto pending = Pending().find(std::string(name));
+        if (pending != Pending().end())
+        {
+            hint->store(pending->second, std::memory_order_relaxed);
+            Pending().erase(pending);
+        }
+    }
+
+private:
+    struct Entry
+    {
+        std::string_view name;
+        std::atomic<size_t>* hint;
+    };
+
+    static std::mutex& Mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<Entry>& Entries()
+    {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    static std::map<std::string, size_t>& Pending()
+    {
+        static std::map<std::string, size_t> pending;
+        return pending;
+    }
+};
+
+namespace detail
+{
+
+//   :    ,    .
+//   relaxed-     CAS:     
+//     ,    
+template <typename Tag>
+class CapacityHint
+{
+public:
+    //     : 1 / WEIGHT
+    static constexpr size_t WEIGHT = 4;
+
+    static size_t Predict() noexcept
+    {
+        EnsureRegistered();
+        return Value().load(std::memory_order_relaxed);
+    }
+
+    static void Record(size_t size) noexcept
+    {
+        EnsureRegistered();
+        std::atomic<size_t>& value = Value();
+        const size_t old = value.load(std::memory_order_relaxed);
+        value.store(old == 0 ? size : Step(old, size), std::memory_order_relaxed);
+    }
+
+private:
+    //    1 / WEIGHT   size    old,
+    //         ,      
+    static constexpr size_t Step(size_t old, size_t size) noexcept
+    {
+        const size_t distance = size > old ? size - old : old - size;
+        const size_t step = distance / WEIGHT + (distance % WEIGHT != 0 ? 1 : 0);
+        return size > old ? old + step : old - step;
+    }
+
+    static std::atomic<size_t>& Value() noexcept
+    {
+        static std::atomic<size_t> value{ 0 };
+        return value;
+    }
+
+    //    CountingInstrumentation,      
+    static void EnsureRegistered() noexcept
+    {
+        static const bool registered = [] {
+            try
+            {
+                CapacityHints::Register(TagName<Tag>::Get(), &Value());
+                return true;
+            }
+            catch (...)
+            {
+                return false;
+            }
+        }();
+        (void)registered;
+    }
+};
+
+} // namespace detail
+
+//  ,       ,    Tag
+template <typename Tag, typename Base = DoublingGrowth>
+struct AdaptiveGrowth
+{
+    template <typename T>
+    static size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        const size_t next = Base::template NextCapacity<T>(capacity, required);
+        return capacity == 0 ? std::max(next, detail::CapacityHint<Tag>::Predict()) : next;
+    }
+
+    template <typename T>
+        requires detail::HasShrinkCapacity<Base, T>
+    static constexpr size_t ShrinkCapacity(size_t capacity, size_t size) noexcept
+    {
+        return Base::template ShrinkCapacity<T>(capacity, size);
+    }
+};
+
+//  ,        Tag.
+//  ,    ,        
+template <typename Tag>
+struct CapacityHintRecorder : NoInstrumentation
+{
+    static void OnDestroy(size_t size) noexcept
+    {
+        if (size != 0)
+        {
+            detail::CapacityHint<Tag>::Record(size);
+        }
+    }
+};
+
+// ,           Tag  
+//     .    ;    Tag::NAME,   
+template <typename T, typename Tag, typename Allocator = std::allocator<T>, typename Base = DoublingGrowth>
+using AdaptiveVector = Vector<T, Allocator, AdaptiveGrowth<Tag, Base>, CapacityHintRecorder<Tag>>;
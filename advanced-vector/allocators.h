@@ -0,0 +1,570 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//   malloc/realloc/free.   ( MMAP_THRESHOLD )  Linux
+//   mmap    mremap:     ,
+//       ,    .
+// Vector   expand/reallocate    
+template <typename T>
+class ReallocAllocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    static constexpr size_t MMAP_THRESHOLD = 64 * 1024 * 1024;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "malloc does not guarantee over-aligned storage");
+
+    ReallocAllocator() = default;
+
+    template <typename U>
+    ReallocAllocator(const ReallocAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        const size_t bytes = Bytes(n);
+        void* p = IsMapped(bytes) ? Map(bytes) : std::malloc(bytes);
+        if (p == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        const size_t bytes = Bytes(n);
+        if (IsMapped(bytes))
+        {
+            Unmap(p, bytes);
+        }
+        else
+        {
+            std::free(p);
+        }
+    }
+
+    //  ,    .    ,   mmap
+    bool expand([[maybe_unused]] T* p, size_t old_n, size_t new_n) noexcept
+    {
+        if (new_n > static_cast<size_t>(-1) / sizeof(T))
+        {
+            return false;
+        }
+        const size_t old_bytes = Bytes(old_n);
+        const size_t new_bytes = Bytes(new_n);
+        if (!IsMapped(old_bytes) || !IsMapped(new_bytes))
+        {
+            return false;
+        }
+        if (RoundToPage(new_bytes) == RoundToPage(old_bytes))
+        {
+            return true;
+        }
+#if defined(__linux__)
+        return mremap(p, RoundToPage(old_bytes), RoundToPage(new_bytes), 0) != MAP_FAILED;
+#else
+        return false;
+#endif
+    }
+
+    //  ,    .   .
+    //    std::bad_alloc,     
+    T* reallocate(T* p, size_t old_n, size_t new_n)
+    {
+        const size_t old_bytes = Bytes(old_n);
+        const size_t new_bytes = Bytes(new_n);
+        void* result = nullptr;
+        if (!IsMapped(old_bytes) && !IsMapped(new_bytes))
+        {
+            result = std::realloc(p, new_bytes);
+        }
+#if defined(__linux__)
+        else if (IsMapped(old_bytes) && IsMapped(new_bytes))
+        {
+            result = mremap(p, RoundToPage(old_bytes), RoundToPage(new_bytes), MREMAP_MAYMOVE);
+            result = result == MAP_FAILED ? nullptr : result;
+        }
+#endif
+        else
+        {
+            T* fresh = allocate(new_n);
+            std::memcpy(static_cast<void*>(fresh), static_cast<const void*>(p), std::min(old_bytes, new_bytes));
+            deallocate(p, old_n);
+            return fresh;
+        }
+        if (result == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(result);
+    }
+
+    template <typename U>
+    bool operator==(const ReallocAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+    static size_t Bytes(size_t n)
+    {
+        if (n > static_cast<size_t>(-1) / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return n * sizeof(T);
+    }
+
+    static bool IsMapped([[maybe_unused]] size_t bytes) noexcept
+    {
+#if defined(__linux__)
+        return bytes >= MMAP_THRESHOLD;
+#else
+        return false;
+#endif
+    }
+
+#if defined(__linux__)
+    static size_t RoundToPage(size_t bytes) noexcept
+    {
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return (bytes + page_size - 1) / page_size * page_size;
+    }
+
+    static void* Map(size_t bytes) noexcept
+    {
+        void* p = mmap(nullptr, RoundToPage(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    static void Unmap(void* p, size_t bytes) noexcept
+    {
+        munmap(p, RoundToPage(bytes));
+    }
+#else
+    static size_t RoundToPage(size_t bytes) noexcept
+    {
+        return bytes;
+    }
+
+    static void* Map(size_t) noexcept
+    {
+        return nullptr;
+    }
+
+    static void Unmap(void*, size_t) noexcept
+    {
+    }
+#endif
+};
+
+//  -: ,   ,      
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+// ,    Alignment  (,    SIMD  -)
+template <typename T, size_t Alignment = CACHE_LINE_SIZE>
+class AlignedAllocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    static constexpr size_t ALIGNMENT = std::max(Alignment, alignof(T));
+
+    static_assert(std::has_single_bit(Alignment), "Alignment must be a power of two");
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        if (n > static_cast<size_t>(-1) / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ ALIGNMENT }));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        ::operator delete(p, n * sizeof(T), std::align_val_t{ ALIGNMENT });
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+        return true;
+    }
+};
+
+//    .   HUGE_PAGE_SIZE      ,
+//        Linux  MADV_HUGEPAGE,    TLB.
+//     -.  expand      
+// ,   
+template <typename T>
+class HugePageAllocator
+{
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static constexpr size_t SMALL_ALIGNMENT = std::max(CACHE_LINE_SIZE, alignof(T));
+
+    static_assert(alignof(T) <= HUGE_PAGE_SIZE);
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        const size_t bytes = Bytes(n);
+        if (!IsHuge(bytes))
+        {
+            return static_cast<T*>(::operator new(bytes, std::align_val_t{ SMALL_ALIGNMENT }));
+        }
+        return static_cast<T*>(MapHuge(RoundToHugePage(bytes)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        const size_t bytes = n * sizeof(T);
+        if (!IsHuge(bytes))
+        {
+            ::operator delete(p, bytes, std::align_val_t{ SMALL_ALIGNMENT });
+            return;
+        }
+        UnmapHuge(p, RoundToHugePage(bytes));
+    }
+
+    //    ,         
+    //       
+    bool expand([[maybe_unused]] T* p, size_t old_n, size_t new_n) noexcept
+    {
+        if (new_n > (static_cast<size_t>(-1) - HUGE_PAGE_SIZE) / sizeof(T))
+        {
+            return false;
+        }
+        const size_t old_bytes = old_n * sizeof(T);
+        const size_t new_bytes = new_n * sizeof(T);
+        if (!IsHuge(old_bytes) || !IsHuge(new_bytes))
+        {
+            return false;
+        }
+        if (RoundToHugePage(new_bytes) == RoundToHugePage(old_bytes))
+        {
+            return true;
+        }
+#if defined(__linux__)
+        if (mremap(p, RoundToHugePage(old_bytes), RoundToHugePage(new_bytes), 0) != MAP_FAILED)
+        {
+            Advise(p, RoundToHugePage(new_bytes));
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+private:
+    static size_t Bytes(size_t n)
+    {
+        if (n > (static_cast<size_t>(-1) - HUGE_PAGE_SIZE) / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return n * sizeof(T);
+    }
+
+    static bool IsHuge(size_t bytes) noexcept
+    {
+        return bytes >= HUGE_PAGE_SIZE;
+    }
+
+    static size_t RoundToHugePage(size_t bytes) noexcept
+    {
+        return (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    }
+
+#if defined(__linux__)
+    //  size + HUGE_PAGE_SIZE     ,       
+    static void* MapHuge(size_t size)
+    {
+        const size_t mapped = size + HUGE_PAGE_SIZE;
+        void* raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        auto* begin = static_cast<std::byte*>(raw);
+        const auto address = reinterpret_cast<std::uintptr_t>(begin);
+        const size_t head = (HUGE_PAGE_SIZE - address % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE;
+        if (head != 0)
+        {
+            munmap(begin, head);
+        }
+        if (HUGE_PAGE_SIZE - head != 0)
+        {
+            munmap(begin + head + size, HUGE_PAGE_SIZE - head);
+        }
+        Advise(begin + head, size);
+        return begin + head;
+    }
+
+    static void UnmapHuge(void* p, size_t size) noexcept
+    {
+        munmap(p, size);
+    }
+
+    static void Advise([[maybe_unused]] void* p, [[maybe_unused]] size_t size) noexcept
+    {
+#if defined(MADV_HUGEPAGE)
+        madvise(p, size, MADV_HUGEPAGE);
+#endif
+    }
+#else
+    static void* MapHuge(size_t size)
+    {
+        return ::operator new(size, std::align_val_t{ HUGE_PAGE_SIZE });
+    }
+
+    static void UnmapHuge(void* p, size_t size) noexcept
+    {
+        ::operator delete(p, size, std::align_val_t{ HUGE_PAGE_SIZE });
+    }
+#endif
+};
+
+//       NUMA
+enum class NumaPolicy
+{
+    //     ,     
+    FirstTouch,
+    //      
+    Bind,
+    //        
+    Interleave,
+};
+
+// ,       NUMA.   MAP_THRESHOLD 
+//   mmap   Linux    mbind.    malloc,  
+//  ,    ,       , 
+//  FirstTouch   Vector  pin_threads     
+// ,    .   :     ,
+//    .     -
+template <typename T>
+class NumaAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    static constexpr size_t PAGE_SIZE = 4096;
+    static constexpr size_t MAP_THRESHOLD = 64 * 1024;
+    static constexpr size_t SMALL_ALIGNMENT = std::max(CACHE_LINE_SIZE, alignof(T));
+    //    
+    static constexpr unsigned MAX_NODES = 64;
+
+    static_assert(alignof(T) <= PAGE_SIZE);
+
+    NumaAllocator() = default;
+
+    // nodes     Bind  Interleave:  i   i
+    explicit NumaAllocator(NumaPolicy policy, uint64_t nodes = 0) noexcept
+        : policy_(policy)
+        , nodes_(nodes)
+    {
+    }
+
+    template <typename U>
+    NumaAllocator(const NumaAllocator<U>& other) noexcept
+        : policy_(other.Policy())
+        , nodes_(other.Nodes())
+    {
+    }
+
+    static NumaAllocator OnNode(unsigned node) noexcept
+    {
+        return NumaAllocator(NumaPolicy::Bind, node < MAX_NODES ? uint64_t{ 1 } << node : 0);
+    }
+
+    static NumaAllocator Interleaved(uint64_t nodes) noexcept
+    {
+        return NumaAllocator(NumaPolicy::Interleave, nodes);
+    }
+
+    T* allocate(size_t n)
+    {
+        const size_t bytes = Bytes(n);
+        if (!IsMapped(bytes))
+        {
+            return static_cast<T*>(::operator new(bytes, std::align_val_t{ SMALL_ALIGNMENT }));
+        }
+        return static_cast<T*>(Map(RoundToPage(bytes)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        const size_t bytes = n * sizeof(T);
+        if (!IsMapped(bytes))
+        {
+            ::operator delete(p, bytes, std::align_val_t{ SMALL_ALIGNMENT });
+            return;
+        }
+        Unmap(p, RoundToPage(bytes));
+    }
+
+    //     .      
+    bool expand([[maybe_unused]] T* p, size_t old_n, size_t new_n) noexcept
+    {
+        if (new_n > (static_cast<size_t>(-1) - PAGE_SIZE) / sizeof(T))
+        {
+            return false;
+        }
+        const size_t old_bytes = old_n * sizeof(T);
+        const size_t new_bytes = new_n * sizeof(T);
+        if (!IsMapped(old_bytes) || !IsMapped(new_bytes))
+        {
+            return false;
+        }
+        if (RoundToPage(new_bytes) == RoundToPage(old_bytes))
+        {
+            return true;
+        }
+#if defined(__linux__)
+        if (mremap(p, RoundToPage(old_bytes), RoundToPage(new_bytes), 0) != MAP_FAILED)
+        {
+            Place(p, RoundToPage(new_bytes));
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    NumaPolicy Policy() const noexcept
+    {
+        return policy_;
+    }
+
+    uint64_t Nodes() const noexcept
+    {
+        return nodes_;
+    }
+
+    template <typename U>
+    bool operator==(const NumaAllocator<U>& other) const noexcept
+    {
+        return policy_ == other.Policy() && nodes_ == other.Nodes();
+    }
+
+private:
+    static size_t Bytes(size_t n)
+    {
+        if (n > (static_cast<size_t>(-1) - PAGE_SIZE) / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return n * sizeof(T);
+    }
+
+    static bool IsMapped(size_t bytes) noexcept
+    {
+        return bytes >= MAP_THRESHOLD;
+    }
+
+    static size_t RoundToPage(size_t bytes) noexcept
+    {
+        return (bytes + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+    }
+
+#if defined(__linux__)
+    void* Map(size_t size) const
+    {
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        Place(p, size);
+        return p;
+    }
+
+    static void Unmap(void* p, size_t size) noexcept
+    {
+        munmap(p, size);
+    }
+
+    //      :     
+    void Place([[maybe_unused]] void* p, [[maybe_unused]] size_t size) const noexcept
+    {
+#if defined(SYS_mbind)
+        //  MPOL_BIND  MPOL_INTERLEAVE  <linux/mempolicy.h>
+        constexpr long BIND_MODE = 2;
+        constexpr long INTERLEAVE_MODE = 3;
+        if (policy_ == NumaPolicy::FirstTouch || nodes_ == 0)
+        {
+            return;
+        }
+        unsigned long mask[(MAX_NODES + 8 * sizeof(unsigned long) - 1) / (8 * sizeof(unsigned long))] = {};
+        std::memcpy(mask, &nodes_, sizeof(nodes_));
+        //     maxnode,       
+        syscall(SYS_mbind, p, size, policy_ == NumaPolicy::Bind ? BIND_MODE : INTERLEAVE_MODE, mask,
+            static_cast<unsigned long>(MAX_NODES + 1), 0u);
+#endif
+    }
+#else
+    void* Map(size_t size) const
+    {
+        return ::operator new(size, std::align_val_t{ PAGE_SIZE });
+    }
+
+    static void Unmap(void* p, size_t size) noexcept
+    {
+        ::operator delete(p, size, std::align_val_t{ PAGE_SIZE });
+    }
+#endif
+
+    NumaPolicy policy_ = NumaPolicy::FirstTouch;
+    uint64_t nodes_ = 0;
+};
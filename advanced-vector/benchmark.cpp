@@ -0,0 +1,499 @@
+//  Vector<T>  std::vector<T>   ,     .
+// : benchmark [--max-size N] [--filter ]
+#include "vector.h"
+#include "simd_algorithms.h"
+#include "segmented_vector.h"
+#include "soa_vector.h"
+#include "flat_map.h"
+#include "vector_algorithms.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+    //      (   )
+    size_t g_allocations = 0;
+    size_t g_allocated_bytes = 0;
+
+    template <typename T>
+    struct StatsAllocator {
+        using value_type = T;
+
+        StatsAllocator() = default;
+        template <typename U>
+        StatsAllocator(const StatsAllocator<U>&) noexcept {
+        }
+
+        T* allocate(size_t n) {
+            ++g_allocations;
+            g_allocated_bytes += n * sizeof(T);
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T* p, size_t n) noexcept {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const StatsAllocator<U>&) const noexcept {
+            return true;
+        }
+    };
+
+    //    value ,   - 
+    template <typename T>
+    void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        //  GCC-     volatile-,   
+        static const void* volatile sink;
+        sink = std::addressof(value);
+#if defined(_MSC_VER)
+        _ReadWriteBarrier();
+#endif
+#endif
+    }
+
+    //  
+    using Trivial = int64_t;
+
+    //    ,   ( unique_ptr)
+    struct MoveOnly {
+        MoveOnly() = default;
+        explicit MoveOnly(int64_t value)
+            : value(new int64_t(value)) {
+        }
+        MoveOnly(const MoveOnly&) = delete;
+        MoveOnly& operator=(const MoveOnly&) = delete;
+        MoveOnly(MoveOnly&& other) noexcept
+            : value(std::exchange(other.value, nullptr)) {
+        }
+        MoveOnly& operator=(MoveOnly&& other) noexcept {
+            std::swap(value, other.value);
+            return *this;
+        }
+        ~MoveOnly() {
+            delete value;
+        }
+        int64_t* value = nullptr;
+    };
+
+    //      noexcept:     
+    struct ThrowingMove {
+        ThrowingMove() = default;
+        explicit ThrowingMove(int64_t value)
+            : value(std::to_string(value)) {
+        }
+        ThrowingMove(const ThrowingMove&) = default;
+        ThrowingMove& operator=(const ThrowingMove&) = default;
+        ThrowingMove(ThrowingMove&& other) noexcept(false)
+            : value(std::move(other.value)) {
+        }
+        ThrowingMove& operator=(ThrowingMove&& other) noexcept(false) {
+            value = std::move(other.value);
+            return *this;
+        }
+        std::string value;
+    };
+
+    //    
+    struct Large {
+        Large() = default;
+        explicit Large(int64_t value) {
+            payload[0] = value;
+        }
+        int64_t payload[32] = {};
+    };
+
+    template <typename T>
+    T Make(size_t i) {
+        if constexpr (std::is_same_v<T, Trivial>) {
+            return static_cast<T>(i);
+        }
+        else {
+            return T(static_cast<int64_t>(i));
+        }
+    }
+
+    //     
+    template <typename T>
+    struct StdVectorOps {
+        using Container = std::vector<T, StatsAllocator<T>>;
+        static constexpr string_view NAME = "std::vector"sv;
+
+        static void PushBack(Container& c, T&& value) {
+            c.push_back(std::move(value));
+        }
+        static void Reserve(Container& c, size_t n) {
+            c.reserve(n);
+        }
+        static void InsertMiddle(Container& c, T&& value) {
+            c.insert(c.begin() + c.size() / 2, std::move(value));
+        }
+        static void EraseMiddle(Container& c) {
+            c.erase(c.begin() + c.size() / 2);
+        }
+    };
+
+    template <typename T>
+    struct VectorOps {
+        using Container = Vector<T, StatsAllocator<T>>;
+        static constexpr string_view NAME = "Vector"sv;
+
+        static void PushBack(Container& c, T&& value) {
+            c.PushBack(std::move(value));
+        }
+        static void Reserve(Container& c, size_t n) {
+            c.Reserve(n);
+        }
+        static void InsertMiddle(Container& c, T&& value) {
+            c.Insert(c.cbegin() + c.Size() / 2, std::move(value));
+        }
+        static void EraseMiddle(Container& c) {
+            c.Erase(c.cbegin() + c.Size() / 2);
+        }
+    };
+
+    template <typename T>
+    struct SegmentedVectorOps {
+        using Container = SegmentedVector<T, StatsAllocator<T>>;
+        static constexpr string_view NAME = "Segmented"sv;
+
+        static void PushBack(Container& c, T&& value) {
+            c.PushBack(std::move(value));
+        }
+        static void Reserve(Container& c, size_t n) {
+            c.Reserve(n);
+        }
+        static void InsertMiddle(Container& c, T&& value) {
+            c.Insert(c.cbegin() + c.Size() / 2, std::move(value));
+        }
+        static void EraseMiddle(Container& c) {
+            c.Erase(c.cbegin() + c.Size() / 2);
+        }
+    };
+
+    struct Measurement {
+        double ns_per_op = 0;
+        size_t allocations = 0;
+        size_t bytes = 0;
+    };
+
+    //  body ,   ,      50 ,
+    //      .      
+    template <typename Body>
+    Measurement Measure(size_t ops_per_run, Body body) {
+        using Clock = std::chrono::steady_clock;
+        const auto min_duration = std::chrono::milliseconds(50);
+        Measurement result;
+        const size_t allocations_before = g_allocations;
+        const size_t bytes_before = g_allocated_bytes;
+        body();
+        result.allocations = g_allocations - allocations_before;
+        result.bytes = g_allocated_bytes - bytes_before;
+
+        for (size_t runs = 1;; runs *= 2) {
+            const auto start = Clock::now();
+            for (size_t i = 0; i < runs; ++i) {
+                body();
+            }
+            const auto duration = Clock::now() - start;
+            if (duration >= min_duration) {
+                const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+                result.ns_per_op = ns / static_cast<double>(runs * std::max<size_t>(ops_per_run, 1));
+                return result;
+            }
+        }
+    }
+
+    struct Options {
+        size_t max_size = 1'000'000;
+        string filter;
+    };
+
+    void Report(string_view benchmark, string_view container, string_view type, size_t size, const Measurement& m) {
+        std::printf("%-14s %-12s %-13s %10zu %12.2f %14zu %8zu\n", string(benchmark).c_str(), string(container).c_str(),
+            string(type).c_str(), size, m.ns_per_op, m.bytes, m.allocations);
+    }
+
+    template <typename Ops, typename T>
+    void RunContainer(const Options& options, string_view type) {
+        using Container = typename Ops::Container;
+        for (size_t size = 1; size <= options.max_size; size *= 10) {
+            Report("push_back"sv, Ops::NAME, type, size, Measure(size, [size] {
+                Container c;
+                for (size_t i = 0; i < size; ++i) {
+                    Ops::PushBack(c, Make<T>(i));
+                }
+                DoNotOptimize(c);
+                }));
+
+            Report("reserve+push"sv, Ops::NAME, type, size, Measure(size, [size] {
+                Container c;
+                Ops::Reserve(c, size);
+                for (size_t i = 0; i < size; ++i) {
+                    Ops::PushBack(c, Make<T>(i));
+                }
+                DoNotOptimize(c);
+                }));
+
+            Container filled;
+            for (size_t i = 0; i < size; ++i) {
+                Ops::PushBack(filled, Make<T>(i));
+            }
+            //      ,    
+            const size_t middle_ops = std::min<size_t>(size, 1000);
+            Report("insert_middle"sv, Ops::NAME, type, size, Measure(middle_ops, [&filled, middle_ops] {
+                for (size_t i = 0; i < middle_ops; ++i) {
+                    Ops::InsertMiddle(filled, Make<T>(i));
+                }
+                for (size_t i = 0; i < middle_ops; ++i) {
+                    Ops::EraseMiddle(filled);
+                }
+                DoNotOptimize(filled);
+                }));
+
+            if constexpr (std::is_copy_constructible_v<T>) {
+                Report("copy_assign"sv, Ops::NAME, type, size, Measure(size, [&filled] {
+                    Container copy;
+                    copy = filled;
+                    DoNotOptimize(copy);
+                    }));
+            }
+
+            Report("move_assign"sv, Ops::NAME, type, size, Measure(1, [&filled] {
+                Container moved;
+                moved = std::move(filled);
+                filled = std::move(moved);
+                DoNotOptimize(filled);
+                }));
+
+            Report("iterate"sv, Ops::NAME, type, size, Measure(size, [&filled] {
+                size_t count = 0;
+                for (const T& value : filled) {
+                    DoNotOptimize(value);
+                    ++count;
+                }
+                DoNotOptimize(count);
+                }));
+        }
+    }
+
+    template <typename T>
+    void RunType(const Options& options, string_view type) {
+        if (!options.filter.empty() && type.find(options.filter) == string_view::npos) {
+            return;
+        }
+        //           
+        Options typed = options;
+        if constexpr (sizeof(T) > 64) {
+            typed.max_size = std::min<size_t>(typed.max_size, 1'000'000);
+        }
+        RunContainer<StdVectorOps<T>, T>(typed, type);
+        RunContainer<VectorOps<T>, T>(typed, type);
+        RunContainer<SegmentedVectorOps<T>, T>(typed, type);
+    }
+
+    string_view LevelName(SimdLevel level) {
+        switch (level) {
+        case SimdLevel::Neon:
+            return "neon"sv;
+        case SimdLevel::Avx2:
+            return "avx2"sv;
+        case SimdLevel::Avx512:
+            return "avx512"sv;
+        default:
+            return "scalar"sv;
+        }
+    }
+
+    //   simd_algorithms.h     
+    template <typename T>
+    void RunSimd(const Options& options, string_view type) {
+        if (!options.filter.empty() && string_view("simd").find(options.filter) == string_view::npos
+            && type.find(options.filter) == string_view::npos) {
+            return;
+        }
+        const SimdLevel detected = DetectSimdLevel();
+        for (size_t size = 1000; size <= options.max_size; size *= 10) {
+            SimdVector<T> data(size);
+            for (size_t i = 0; i < size; ++i) {
+                data[i] = static_cast<T>(i % 1000);
+            }
+            for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512 }) {
+                if (level > detected || (level == SimdLevel::Neon && detected != SimdLevel::Neon)) {
+                    continue;
+                }
+                SetSimdLevel(level);
+                Report("sum"sv, LevelName(level), type, size, Measure(size, [&data] {
+                    DoNotOptimize(Sum(data));
+                    }));
+                Report("find"sv, LevelName(level), type, size, Measure(size, [&data] {
+                    DoNotOptimize(Find(data, static_cast<T>(-1)));
+                    }));
+                Report("minmax"sv, LevelName(level), type, size, Measure(size, [&data] {
+                    DoNotOptimize(MinMax(data));
+                    }));
+                Report("fill"sv, LevelName(level), type, size, Measure(size, [&data] {
+                    Fill(data, static_cast<T>(1));
+                    DoNotOptimize(data);
+                    }));
+            }
+            SetSimdLevel(detected);
+        }
+    }
+
+    //    ,      
+    struct Particle {
+        double x, vx, y, vy, z, vz, mass, charge;
+    };
+
+    //     :     
+    void RunSoA(const Options& options) {
+        if (!options.filter.empty() && string_view("soa").find(options.filter) == string_view::npos) {
+            return;
+        }
+        for (size_t size = 1000; size <= options.max_size; size *= 10) {
+            Vector<Particle> aos(size);
+            SoAVector<double, double, double, double, double, double, double, double> soa(size);
+            Report("scan_2_of_8"sv, "Vector"sv, "soa"sv, size, Measure(size, [&aos] {
+                for (Particle& p : aos) {
+                    p.x += p.vx;
+                }
+                DoNotOptimize(aos);
+                }));
+            Report("scan_2_of_8"sv, "SoAVector"sv, "soa"sv, size, Measure(size, [&soa] {
+                std::span<double> x = soa.Column<0>();
+                std::span<const double> vx = soa.Column<1>();
+                for (size_t i = 0; i < x.size(); ++i) {
+                    x[i] += vx[i];
+                }
+                DoNotOptimize(soa);
+                }));
+        }
+    }
+
+    //   :   FlatMap   std::map
+    void RunFlatMap(const Options& options) {
+        if (!options.filter.empty() && string_view("flat_map").find(options.filter) == string_view::npos) {
+            return;
+        }
+        for (size_t size = 1000; size <= options.max_size; size *= 10) {
+            Vector<std::pair<uint64_t, uint64_t>> pairs;
+            std::map<uint64_t, uint64_t> tree;
+            for (uint64_t i = 0; i < size; ++i) {
+                //  ,         
+                const uint64_t key = (i * 0x9e3779b97f4a7c15ull) >> 16;
+                pairs.EmplaceBack(key, i);
+                tree.emplace(key, i);
+            }
+            FlatMap<uint64_t, uint64_t> flat;
+            flat.InsertRange(pairs.begin(), pairs.end());
+            //     ,  ,       
+            Vector<uint64_t> queries;
+            for (size_t i = 0; i < size; ++i) {
+                queries.PushBack(pairs[i * 7919 % size].first);
+            }
+            Report("find"sv, "std::map"sv, "flat_map"sv, size, Measure(size, [&queries, &tree] {
+                uint64_t sum = 0;
+                for (uint64_t key : queries) {
+                    sum += tree.find(key)->second;
+                }
+                DoNotOptimize(sum);
+                }));
+            Report("find"sv, "FlatMap"sv, "flat_map"sv, size, Measure(size, [&queries, &flat] {
+                uint64_t sum = 0;
+                for (uint64_t key : queries) {
+                    sum += flat.Find(key)->second;
+                }
+                DoNotOptimize(sum);
+                }));
+        }
+    }
+
+    void RunAlgorithms(const Options& options) {
+        if (!options.filter.empty() && string_view("algorithms").find(options.filter) == string_view::npos) {
+            return;
+        }
+        ThreadPool& pool = ThreadPool::Default();
+        for (size_t size = 100'000; size <= options.max_size; size *= 10) {
+            Vector<uint64_t> source(size);
+            for (size_t i = 0; i < size; ++i) {
+                source[i] = (i * 0x9e3779b97f4a7c15ull) ^ (i >> 3);
+            }
+            Vector<uint64_t> data;
+            //        
+            Report("sort"sv, "std::sort"sv, "algorithms"sv, size, Measure(size, [&source, &data] {
+                data = source;
+                std::sort(data.begin(), data.end());
+                DoNotOptimize(data[0]);
+                }));
+            Report("sort"sv, "ParallelSort"sv, "algorithms"sv, size, Measure(size, [&source, &data, &pool] {
+                data = source;
+                ParallelSort(pool, data);
+                DoNotOptimize(data[0]);
+                }));
+            Report("scan"sv, "std::scan"sv, "algorithms"sv, size, Measure(size, [&source, &data] {
+                data = source;
+                std::inclusive_scan(data.begin(), data.end(), data.begin());
+                DoNotOptimize(data[0]);
+                }));
+            Report("scan"sv, "ParallelScan"sv, "algorithms"sv, size, Measure(size, [&source, &data, &pool] {
+                data = source;
+                ParallelInclusiveScan(pool, data);
+                DoNotOptimize(data[0]);
+                }));
+        }
+    }
+
+    Options ParseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const string_view arg = argv[i];
+            if (arg == "--max-size"sv && i + 1 < argc) {
+                options.max_size = std::strtoull(argv[++i], nullptr, 10);
+            }
+            else if (arg == "--filter"sv && i + 1 < argc) {
+                options.filter = argv[++i];
+            }
+            else {
+                cerr << "Usage: "sv << argv[0] << " [--max-size N] [--filter type]"sv << endl;
+                std::exit(1);
+            }
+        }
+        return options;
+    }
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const Options options = ParseOptions(argc, argv);
+    std::printf("%-14s %-12s %-13s %10s %12s %14s %8s\n", "benchmark", "container", "type", "size", "ns/op", "bytes",
+        "allocs");
+    RunType<Trivial>(options, "trivial"sv);
+    RunType<MoveOnly>(options, "move_only"sv);
+    RunType<ThrowingMove>(options, "throwing_move"sv);
+    RunType<Large>(options, "large"sv);
+    RunSimd<float>(options, "simd_float"sv);
+    RunSimd<int32_t>(options, "simd_int32"sv);
+    RunSoA(options);
+    RunFlatMap(options);
+    RunAlgorithms(options);
+}
@@ -0,0 +1,261 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//        .
+// EmplaceBack          RawMemory;
+//       ,     .
+//     : ,     ,  
+//    compare_exchange;     .
+//           ,   .
+// Clear, Freeze         
+template <typename T, typename Allocator = std::allocator<T>>
+class ConcurrentVector
+{
+public:
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+
+    static constexpr size_t MIN_FIRST_SEGMENT = 32;
+
+    //      first_segment_capacity .
+    //       , Freeze     
+    explicit ConcurrentVector(size_t first_segment_capacity = 0, const allocator_type& alloc = allocator_type())
+        : first_log2_(static_cast<unsigned>(std::countr_zero(std::bit_ceil(std::max(first_segment_capacity, MIN_FIRST_SEGMENT)))))
+        , alloc_(alloc)
+    {
+    }
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    ~ConcurrentVector()
+    {
+        Clear();
+    }
+
+    //   ,  ,   
+    size_t Size() const noexcept
+    {
+        return std::min(reserved_.load(std::memory_order_acquire), MaxSize());
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<ConcurrentVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < Size());
+        const detail::SegmentPosition pos = detail::LocateSegment(index, first_log2_);
+        return segments_[pos.segment].load(std::memory_order_acquire)->data[pos.offset];
+    }
+
+    template <typename V>
+    T& PushBack(V&& value)
+    {
+        return EmplaceBack(std::forward<V>(value));
+    }
+
+    //       ,      Freeze
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        const size_t index = reserved_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MaxSize())
+        {
+            throw std::length_error("ConcurrentVector is full");
+        }
+        const detail::SegmentPosition pos = detail::LocateSegment(index, first_log2_);
+        //   ,       ,   
+        Segment* segment = nullptr;
+        try
+        {
+            segment = &GetSegment(pos.segment);
+            new (segment->data + pos.offset) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            failed_.fetch_add(1, std::memory_order_relaxed);
+            throw;
+        }
+        segment->ready[pos.offset].store(true, std::memory_order_release);
+        return segment->data[pos.offset];
+    }
+
+    //     capacity .     EmplaceBack
+    void Reserve(size_t capacity)
+    {
+        for (size_t segment = 0; segment < SegmentCount() && detail::SegmentStart(segment, first_log2_) < capacity; ++segment)
+        {
+            GetSegment(segment);
+        }
+    }
+
+    //     
+    void Clear() noexcept
+    {
+        ForEachSegment([](Segment& segment, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (segment.ready[i].load(std::memory_order_relaxed))
+                {
+                    std::destroy_at(segment.data + i);
+                }
+            }
+        });
+        DropSegments();
+    }
+
+    //         .
+    //     .    ,
+    // ConcurrentVector  
+    Vector<T, Allocator> Freeze()
+    {
+        const size_t size = Size();
+        const size_t failed = failed_.load(std::memory_order_relaxed);
+        const size_t count = size - failed;
+        if (failed == 0 && size <= detail::SegmentSize(0, first_log2_))
+        {
+            Segment* first = segments_[0].load(std::memory_order_relaxed);
+            if (first == nullptr)
+            {
+                return Vector<T, Allocator>(alloc_);
+            }
+            Vector<T, Allocator> result(std::move(first->data), size);
+            DropSegments();
+            return result;
+        }
+
+        RawMemory<T, Allocator> buffer(count, alloc_);
+        size_t built = 0;
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            ForEachSegment([&buffer, &built, failed](Segment& segment, size_t n) {
+                if (failed == 0)
+                {
+                    detail::RelocateBytes(buffer + built, segment.data.GetAddress(), n);
+                    built += n;
+                    return;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (segment.ready[i].load(std::memory_order_relaxed))
+                    {
+                        detail::RelocateBytes(buffer + built++, segment.data + i, 1);
+                    }
+                }
+            });
+            //   ,    
+            DropSegments();
+        }
+        else
+        {
+            try
+            {
+                ForEachSegment([&buffer, &built](Segment& segment, size_t n) {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        if (segment.ready[i].load(std::memory_order_relaxed))
+                        {
+                            new (buffer + built) T(std::move_if_noexcept(segment.data[i]));
+                            ++built;
+                        }
+                    }
+                });
+            }
+            catch (...)
+            {
+                std::destroy_n(buffer.GetAddress(), built);
+                throw;
+            }
+            Clear();
+        }
+        assert(built == count);
+        return Vector<T, Allocator>(std::move(buffer), built);
+    }
+
+private:
+    static constexpr size_t MAX_SEGMENTS = detail::MaxSegmentCount(0);
+
+    struct Segment
+    {
+        Segment(size_t capacity, const allocator_type& alloc)
+            : data(capacity, alloc)
+            , ready(new std::atomic<bool>[capacity])
+        {
+        }
+
+        RawMemory<T, Allocator> data;
+        //   :    ,   -      
+        std::unique_ptr<std::atomic<bool>[]> ready;
+    };
+
+    size_t SegmentCount() const noexcept
+    {
+        return detail::MaxSegmentCount(first_log2_);
+    }
+
+    size_t MaxSize() const noexcept
+    {
+        return detail::SegmentStart(SegmentCount(), first_log2_);
+    }
+
+    Segment& GetSegment(size_t index)
+    {
+        Segment* segment = segments_[index].load(std::memory_order_acquire);
+        if (segment != nullptr)
+        {
+            return *segment;
+        }
+        auto fresh = std::make_unique<Segment>(detail::SegmentSize(index, first_log2_), alloc_);
+        if (segments_[index].compare_exchange_strong(segment, fresh.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return *fresh.release();
+        }
+        return *segment;
+    }
+
+    //  visitor(segment, count)     count  
+    template <typename Visitor>
+    void ForEachSegment(Visitor&& visitor)
+    {
+        const size_t size = Size();
+        for (size_t index = 0; index < SegmentCount() && detail::SegmentStart(index, first_log2_) < size; ++index)
+        {
+            if (Segment* segment = segments_[index].load(std::memory_order_acquire))
+            {
+                const size_t start = detail::SegmentStart(index, first_log2_);
+                visitor(*segment, std::min(size - start, detail::SegmentSize(index, first_log2_)));
+            }
+        }
+    }
+
+    //   ,   
+    void DropSegments() noexcept
+    {
+        for (std::atomic<Segment*>& segment : segments_)
+        {
+            delete segment.exchange(nullptr, std::memory_order_relaxed);
+        }
+        reserved_.store(0, std::memory_order_relaxed);
+        failed_.store(0, std::memory_order_relaxed);
+    }
+
+    const unsigned first_log2_;
+    allocator_type alloc_;
+    std::atomic<size_t> reserved_{ 0 };
+    std::atomic<size_t> failed_{ 0 };
+    std::atomic<Segment*> segments_[MAX_SEGMENTS] = {};
+};
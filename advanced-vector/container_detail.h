@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+//    ,     
+namespace detail
+{
+
+//   :  k  first << k   
+//   first * (2^k - 1),  first = 2^first_log2.        O(1).
+//  SegmentedVector  ConcurrentVector
+struct SegmentPosition
+{
+    size_t segment;
+    size_t offset;
+};
+
+inline constexpr size_t SegmentSize(size_t segment, unsigned first_log2) noexcept
+{
+    return size_t{ 1 } << (first_log2 + segment);
+}
+
+inline constexpr size_t SegmentStart(size_t segment, unsigned first_log2) noexcept
+{
+    return SegmentSize(segment, first_log2) - (size_t{ 1 } << first_log2);
+}
+
+inline constexpr SegmentPosition LocateSegment(size_t index, unsigned first_log2) noexcept
+{
+    const size_t shifted = index + (size_t{ 1 } << first_log2);
+    const size_t segment = static_cast<size_t>(std::bit_width(shifted)) - 1 - first_log2;
+    return { segment, shifted - SegmentSize(segment, first_log2) };
+}
+
+//   :    2^63 ,
+//     
+inline constexpr size_t MaxSegmentCount(unsigned first_log2) noexcept
+{
+    return 63 - first_log2;
+}
+
+//    first,   [first, last)    ;
+// tail -     last.      ,
+//           .
+//    ,  tail  ,    
+//  ,   
+template <typename T, typename It, typename... Args>
+constexpr void ShiftInsert(It first, It last, T* tail, Args&&... args)
+{
+    assert(first != last);
+    T temp(std::forward<Args>(args)...);
+    std::construct_at(tail, std::move(*std::prev(last)));
+    try
+    {
+        std::move_backward(first, std::prev(last), last);
+        *first = std::move(temp);
+    }
+    catch (...)
+    {
+        std::destroy_at(tail);
+        throw;
+    }
+}
+
+//        operator[]
+struct SubscriptAccess
+{
+    template <typename Ref, typename Container>
+    static Ref Get(Container& container, size_t index) noexcept
+    {
+        return container[index];
+    }
+};
+
+//   ,        
+//  Access::Get<Ref>(container, index)   . Container  const -  ,
+//          const.
+//  Ref -  ,       .
+//  Ref - - (   , ), iterator_category  :
+//      LegacyForwardIterator,  
+// std::random_access_iterator    std::ranges
+template <typename Container, typename Ref, typename Access = SubscriptAccess>
+class IndexIterator
+{
+    static constexpr bool IS_PROXY = !std::is_reference_v<Ref>;
+
+    //      ,  operator->    
+    struct ArrowProxy
+    {
+        Ref* operator->() noexcept
+        {
+            return &ref;
+        }
+
+        Ref ref;
+    };
+
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::conditional_t<IS_PROXY, std::input_iterator_tag, std::random_access_iterator_tag>;
+    using value_type = typename std::remove_const_t<Container>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Ref;
+    using pointer = std::conditional_t<IS_PROXY, ArrowProxy, std::add_pointer_t<Ref>>;
+
+    IndexIterator() = default;
+
+    IndexIterator(Container* container, size_t index) noexcept
+        : container_(container)
+        , index_(index)
+    {
+    }
+
+    template <typename OtherContainer, typename OtherRef>
+        requires(std::is_same_v<Container, const OtherContainer>)
+    IndexIterator(const IndexIterator<OtherContainer, OtherRef, Access>& other) noexcept
+        : container_(other.GetContainer())
+        , index_(other.Index())
+    {
+    }
+
+    //   ,    
+    Container* GetContainer() const noexcept
+    {
+        return container_;
+    }
+    size_t Index() const noexcept
+    {
+        return index_;
+    }
+
+    reference operator*() const noexcept
+    {
+        return Access::template Get<Ref>(*container_, index_);
+    }
+    pointer operator->() const noexcept
+    {
+        if constexpr (IS_PROXY)
+        {
+            return ArrowProxy{ **this };
+        }
+        else
+        {
+            return std::addressof(**this);
+        }
+    }
+    reference operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    IndexIterator& operator++() noexcept
+    {
+        ++index_;
+        return *this;
+    }
+    IndexIterator operator++(int) noexcept
+    {
+        IndexIterator prev = *this;
+        ++index_;
+        return prev;
+    }
+    IndexIterator& operator--() noexcept
+    {
+        --index_;
+        return *this;
+    }
+    IndexIterator operator--(int) noexcept
+    {
+        IndexIterator prev = *this;
+        --index_;
+        return prev;
+    }
+    IndexIterator& operator+=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+    IndexIterator& operator-=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    friend IndexIterator operator+(IndexIterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+    friend IndexIterator operator+(difference_type n, IndexIterator it) noexcept
+    {
+        return it += n;
+    }
+    friend IndexIterator operator-(IndexIterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+    friend difference_type operator-(const IndexIterator& lhs, const IndexIterator& rhs) noexcept
+    {
+        assert(lhs.container_ == rhs.container_);
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    friend bool operator==(const IndexIterator& lhs, const IndexIterator& rhs) noexcept
+    {
+        assert(lhs.container_ == rhs.container_);
+        return lhs.index_ == rhs.index_;
+    }
+    friend std::strong_ordering operator<=>(const IndexIterator& lhs, const IndexIterator& rhs) noexcept
+    {
+        assert(lhs.container_ == rhs.container_);
+        return lhs.index_ <=> rhs.index_;
+    }
+
+private:
+    Container* container_ = nullptr;
+    size_t index_ = 0;
+};
+
+} // namespace detail
@@ -0,0 +1,665 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace detail
+{
+
+template <typename Compare>
+concept TransparentCompare = requires { typename Compare::is_transparent; };
+
+//           
+inline constexpr size_t FLAT_SEARCH_PREFETCH_SIZE = 4096;
+
+//     .      
+// ,           log2(size) + 1 
+template <typename T, typename K, typename Compare>
+size_t BranchlessLowerBound(const T* data, size_t size, const K& key, const Compare& comp)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+    const T* base = data;
+    while (size > 1)
+    {
+        const size_t half = size / 2;
+#if defined(__GNUC__) || defined(__clang__)
+        if (size >= FLAT_SEARCH_PREFETCH_SIZE)
+        {
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+        }
+#endif
+        base = comp(base[half - 1], key) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<size_t>(base - data) + (comp(*base, key) ? 1 : 0);
+}
+
+//  staged     ,     
+template <typename E, typename KeyOf, typename Compare>
+void SortUnique(Vector<E>& staged, KeyOf key_of, const Compare& comp)
+{
+    std::stable_sort(staged.begin(), staged.end(), [&](const E& lhs, const E& rhs) {
+        return comp(key_of(lhs), key_of(rhs));
+    });
+    auto last = std::unique(staged.begin(), staged.end(), [&](const E& lhs, const E& rhs) {
+        return !comp(key_of(lhs), key_of(rhs));
+    });
+    staged.Erase(last, staged.end());
+}
+
+} // namespace detail
+
+//     Vector.  -     
+//  ,     .     InsertRange:
+//            .
+//        
+template <typename Key, typename Compare = std::less<Key>>
+class FlatSet
+{
+public:
+    using iterator = const Key*;
+    using const_iterator = const Key*;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& comp)
+        : comp_(comp)
+    {
+    }
+
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    FlatSet(InputIt first, InputIt last, const Compare& comp = Compare())
+        : comp_(comp)
+    {
+        InsertRange(first, last);
+    }
+
+    FlatSet(std::initializer_list<Key> init, const Compare& comp = Compare())
+        : FlatSet(init.begin(), init.end(), comp)
+    {
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return keys_.begin();
+    }
+    const_iterator end() const noexcept
+    {
+        return keys_.end();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return keys_.cbegin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return keys_.cend();
+    }
+
+    size_t Size() const noexcept
+    {
+        return keys_.Size();
+    }
+    size_t Capacity() const noexcept
+    {
+        return keys_.Capacity();
+    }
+    const Key& operator[](size_t index) const noexcept
+    {
+        return keys_[index];
+    }
+    void Reserve(size_t new_capacity)
+    {
+        keys_.Reserve(new_capacity);
+    }
+    void Clear() noexcept
+    {
+        keys_.Clear();
+    }
+
+    const_iterator LowerBound(const Key& key) const
+    {
+        return LowerBoundImpl(key);
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    const_iterator LowerBound(const K& key) const
+    {
+        return LowerBoundImpl(key);
+    }
+
+    const_iterator Find(const Key& key) const
+    {
+        return FindImpl(key);
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    const_iterator Find(const K& key) const
+    {
+        return FindImpl(key);
+    }
+
+    bool Contains(const Key& key) const
+    {
+        return FindImpl(key) != end();
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    bool Contains(const K& key) const
+    {
+        return FindImpl(key) != end();
+    }
+
+    //      ,    
+    template <typename V>
+    std::pair<iterator, bool> Insert(V&& key)
+    {
+        const_iterator pos = LowerBoundImpl(key);
+        if (pos != end() && !comp_(key, *pos))
+        {
+            return { pos, false };
+        }
+        return { keys_.Insert(pos, std::forward<V>(key)), true };
+    }
+
+    //   ,   .     ,
+    //       O(n + m log m)  m   
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    void InsertRange(InputIt first, InputIt last);
+
+    size_t Erase(const Key& key)
+    {
+        return EraseImpl(key);
+    }
+    //    Erase(const_iterator)
+    template <typename K>
+        requires(detail::TransparentCompare<Compare> && !std::is_convertible_v<const K&, const_iterator>)
+    size_t Erase(const K& key)
+    {
+        return EraseImpl(key);
+    }
+
+    const_iterator Erase(const_iterator pos)
+    {
+        return keys_.Erase(pos);
+    }
+
+    void Swap(FlatSet& other) noexcept
+    {
+        keys_.Swap(other.keys_);
+        std::swap(comp_, other.comp_);
+    }
+
+private:
+    template <typename K>
+    const_iterator LowerBoundImpl(const K& key) const
+    {
+        return begin() + detail::BranchlessLowerBound(begin(), Size(), key, comp_);
+    }
+
+    template <typename K>
+    const_iterator FindImpl(const K& key) const
+    {
+        const_iterator pos = LowerBoundImpl(key);
+        return pos != end() && !comp_(key, *pos) ? pos : end();
+    }
+
+    template <typename K>
+    size_t EraseImpl(const K& key)
+    {
+        const_iterator pos = FindImpl(key);
+        if (pos == end())
+        {
+            return 0;
+        }
+        keys_.Erase(pos);
+        return 1;
+    }
+
+    Vector<Key> keys_;
+    [[no_unique_address]] Compare comp_;
+};
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+    requires std::input_iterator<InputIt>
+inline void FlatSet<Key, Compare>::InsertRange(InputIt first, InputIt last)
+{
+    Vector<Key> staged;
+    for (; first != last; ++first)
+    {
+        staged.EmplaceBack(*first);
+    }
+    const auto key_of = [](const Key& key) -> const Key& {
+        return key;
+    };
+    detail::SortUnique(staged, key_of, comp_);
+    if (staged.Size() == 0)
+    {
+        return;
+    }
+    //   -    :    
+    if (Size() == 0 || comp_(keys_.Back(), staged[0]))
+    {
+        keys_.Reserve(Size() + staged.Size());
+        for (Key& key : staged)
+        {
+            keys_.PushBack(std::move(key));
+        }
+        return;
+    }
+    Vector<Key> merged;
+    merged.Reserve(Size() + staged.Size());
+    size_t i = 0;
+    for (Key& key : staged)
+    {
+        while (i < Size() && comp_(keys_[i], key))
+        {
+            merged.PushBack(std::move_if_noexcept(keys_[i++]));
+        }
+        if (i == Size() || comp_(key, keys_[i]))
+        {
+            merged.PushBack(std::move(key));
+        }
+    }
+    for (; i < Size(); ++i)
+    {
+        merged.PushBack(std::move_if_noexcept(keys_[i]));
+    }
+    keys_.Swap(merged);
+}
+
+//      :     ,
+//             L1/L2.
+//      std::pair<const Key&, Value&>,   ,
+//   iterator_category - input_iterator_tag,  iterator_concept - random_access_iterator_tag.
+//        
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FlatMap
+{
+    //         index
+    struct ItemAccess
+    {
+        template <typename Ref, typename Map>
+        static Ref Get(Map& map, size_t index) noexcept
+        {
+            return Ref(map.keys_[index], map.values_[index]);
+        }
+    };
+
+public:
+    using value_type = std::pair<Key, Value>;
+    using iterator = detail::IndexIterator<FlatMap, std::pair<const Key&, Value&>, ItemAccess>;
+    using const_iterator = detail::IndexIterator<const FlatMap, std::pair<const Key&, const Value&>, ItemAccess>;
+
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& comp)
+        : comp_(comp)
+    {
+    }
+
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    FlatMap(InputIt first, InputIt last, const Compare& comp = Compare())
+        : comp_(comp)
+    {
+        InsertRange(first, last);
+    }
+
+    FlatMap(std::initializer_list<value_type> init, const Compare& comp = Compare())
+        : FlatMap(init.begin(), init.end(), comp)
+    {
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, Size());
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, Size());
+    }
+
+    size_t Size() const noexcept
+    {
+        return keys_.Size();
+    }
+    size_t Capacity() const noexcept
+    {
+        return keys_.Capacity();
+    }
+    void Reserve(size_t new_capacity)
+    {
+        keys_.Reserve(new_capacity);
+        values_.Reserve(new_capacity);
+    }
+    void Clear() noexcept
+    {
+        keys_.Clear();
+        values_.Clear();
+    }
+
+    //       
+    std::span<const Key> Keys() const noexcept
+    {
+        return { keys_.begin(), keys_.Size() };
+    }
+    std::span<Value> Values() noexcept
+    {
+        return { values_.begin(), values_.Size() };
+    }
+    std::span<const Value> Values() const noexcept
+    {
+        return { values_.begin(), values_.Size() };
+    }
+
+    iterator LowerBound(const Key& key)
+    {
+        return iterator(this, LowerBoundIndex(key));
+    }
+    const_iterator LowerBound(const Key& key) const
+    {
+        return const_iterator(this, LowerBoundIndex(key));
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    iterator LowerBound(const K& key)
+    {
+        return iterator(this, LowerBoundIndex(key));
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    const_iterator LowerBound(const K& key) const
+    {
+        return const_iterator(this, LowerBoundIndex(key));
+    }
+
+    iterator Find(const Key& key)
+    {
+        return iterator(this, FindIndex(key));
+    }
+    const_iterator Find(const Key& key) const
+    {
+        return const_iterator(this, FindIndex(key));
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    iterator Find(const K& key)
+    {
+        return iterator(this, FindIndex(key));
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    const_iterator Find(const K& key) const
+    {
+        return const_iterator(this, FindIndex(key));
+    }
+
+    bool Contains(const Key& key) const
+    {
+        return FindIndex(key) != Size();
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    bool Contains(const K& key) const
+    {
+        return FindIndex(key) != Size();
+    }
+
+    //  std::out_of_range,   
+    Value& At(const Key& key)
+    {
+        return values_[CheckedIndex(key)];
+    }
+    const Value& At(const Key& key) const
+    {
+        return values_[CheckedIndex(key)];
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    Value& At(const K& key)
+    {
+        return values_[CheckedIndex(key)];
+    }
+    template <typename K>
+        requires detail::TransparentCompare<Compare>
+    const Value& At(const K& key) const
+    {
+        return values_[CheckedIndex(key)];
+    }
+
+    template <typename K>
+    Value& operator[](K&& key)
+    {
+        return values_[TryEmplace(std::forward<K>(key)).first.Index()];
+    }
+
+    //    args,     
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> TryEmplace(K&& key, Args&&... args);
+
+    template <typename K, typename V>
+    std::pair<iterator, bool> InsertOrAssign(K&& key, V&& value)
+    {
+        auto [pos, inserted] = TryEmplace(std::forward<K>(key), std::forward<V>(value));
+        if (!inserted)
+        {
+            values_[pos.Index()] = std::forward<V>(value);
+        }
+        return { pos, inserted };
+    }
+
+    template <typename Pair>
+    std::pair<iterator, bool> Insert(Pair&& pair)
+    {
+        return TryEmplace(std::forward<Pair>(pair).first, std::forward<Pair>(pair).second);
+    }
+
+    //     ,   ;      .
+    //     ,        
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    void InsertRange(InputIt first, InputIt last);
+
+    size_t Erase(const Key& key)
+    {
+        return EraseIndex(FindIndex(key));
+    }
+    //    Erase(const_iterator)
+    template <typename K>
+        requires(detail::TransparentCompare<Compare> && !std::is_convertible_v<const K&, const_iterator>)
+    size_t Erase(const K& key)
+    {
+        return EraseIndex(FindIndex(key));
+    }
+
+    iterator Erase(const_iterator pos)
+    {
+        assert(pos.GetContainer() == this && pos.Index() < Size());
+        EraseIndex(pos.Index());
+        return iterator(this, pos.Index());
+    }
+
+    void Swap(FlatMap& other) noexcept
+    {
+        keys_.Swap(other.keys_);
+        values_.Swap(other.values_);
+        std::swap(comp_, other.comp_);
+    }
+
+private:
+    template <typename K>
+    size_t LowerBoundIndex(const K& key) const
+    {
+        return detail::BranchlessLowerBound(keys_.begin(), keys_.Size(), key, comp_);
+    }
+
+    template <typename K>
+    size_t FindIndex(const K& key) const
+    {
+        const size_t index = LowerBoundIndex(key);
+        return index != Size() && !comp_(key, keys_[index]) ? index : Size();
+    }
+
+    template <typename K>
+    size_t CheckedIndex(const K& key) const
+    {
+        const size_t index = FindIndex(key);
+        if (index == Size())
+        {
+            throw std::out_of_range("FlatMap: key not found");
+        }
+        return index;
+    }
+
+    size_t EraseIndex(size_t index)
+    {
+        if (index == Size())
+        {
+            return 0;
+        }
+        keys_.Erase(keys_.cbegin() + index);
+        values_.Erase(values_.cbegin() + index);
+        return 1;
+    }
+
+    Vector<Key> keys_;
+    Vector<Value> values_;
+    [[no_unique_address]] Compare comp_;
+};
+
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename... Args>
+inline auto FlatMap<Key, Value, Compare>::TryEmplace(K&& key, Args&&... args) -> std::pair<iterator, bool>
+{
+    const size_t index = LowerBoundIndex(key);
+    if (index != Size() && !comp_(key, keys_[index]))
+    {
+        return { iterator(this, index), false };
+    }
+    //    : args     
+    Value value(std::forward<Args>(args)...);
+    keys_.Emplace(keys_.cbegin() + index, std::forward<K>(key));
+    try
+    {
+        values_.Emplace(values_.cbegin() + index, std::move(value));
+    }
+    catch (...)
+    {
+        keys_.Erase(keys_.cbegin() + index);
+        throw;
+    }
+    return { iterator(this, index), true };
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+    requires std::input_iterator<InputIt>
+inline void FlatMap<Key, Value, Compare>::InsertRange(InputIt first, InputIt last)
+{
+    Vector<value_type> staged;
+    for (; first != last; ++first)
+    {
+        staged.EmplaceBack(first->first, first->second);
+    }
+    const auto key_of = [](const value_type& pair) -> const Key& {
+        return pair.first;
+    };
+    detail::SortUnique(staged, key_of, comp_);
+    if (staged.Size() == 0)
+    {
+        return;
+    }
+    const size_t size = Size();
+    //   -    :     
+    if (size == 0 || comp_(keys_.Back(), staged[0].first))
+    {
+        Reserve(size + staged.Size());
+        try
+        {
+            for (value_type& pair : staged)
+            {
+                keys_.PushBack(std::move(pair.first));
+                values_.PushBack(std::move(pair.second));
+            }
+        }
+        catch (...)
+        {
+            keys_.Erase(keys_.cbegin() + size, keys_.cend());
+            values_.Erase(values_.cbegin() + size, values_.cend());
+            throw;
+        }
+        return;
+    }
+    Vector<Key> keys;
+    Vector<Value> values;
+    keys.Reserve(size + staged.Size());
+    values.Reserve(size + staged.Size());
+    //   ,        ,
+    //  :     
+    const auto keep = [this, &keys, &values](size_t index) {
+        if constexpr (std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<Value>)
+        {
+            keys.PushBack(std::move(keys_[index]));
+            values.PushBack(std::move(values_[index]));
+        }
+        else
+        {
+            keys.PushBack(std::as_const(keys_[index]));
+            values.PushBack(std::as_const(values_[index]));
+        }
+    };
+    size_t i = 0;
+    for (value_type& pair : staged)
+    {
+        for (; i < size && comp_(keys_[i], pair.first); ++i)
+        {
+            keep(i);
+        }
+        if (i == size || comp_(pair.first, keys_[i]))
+        {
+            keys.PushBack(std::move(pair.first));
+            values.PushBack(std::move(pair.second));
+        }
+    }
+    for (; i < size; ++i)
+    {
+        keep(i);
+    }
+    keys_.Swap(keys);
+    values_.Swap(values);
+}
@@ -1,8 +1,35 @@
 #include "vector.h"
-
+#include "memory_resource.h"
+#include "allocators.h"
+#include "small_vector.h"
+#include "simd_algorithms.h"
+#include "mapped_vector.h"
+#include "vector_io.h"
+#include "concurrent_vector.h"
+#include "segmented_vector.h"
+#include "soa_vector.h"
+#include "static_vector.h"
+#include "flat_map.h"
+#include "packed_vector.h"
+#include "ring_vector.h"
+#include "shared_vector.h"
+#include "adaptive_vector.h"
+#include "vector_algorithms.h"
+#include "vector_instrumentation.h"
+
+#include <atomic>
+#include <cmath>
+#include <filesystem>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 using namespace std;
 
@@ -544,7 +571,8 @@ void Test6() {
         assert(Obj::num_default_constructed == SIZE);
         assert(Obj::num_constructed_with_id_and_name == 1);
         assert(Obj::num_moved == old_num_moved + 1);
-        assert(Obj::num_move_assigned == SIZE - 3);
+        //       ,   
+        assert(Obj::num_move_assigned == SIZE - 4);
         assert(Obj::num_assigned == 0);
     }
     {
@@ -564,86 +592,152 @@ void Test6() {
     }
 }
 
-struct C {
-    C() noexcept {
-        ++def_ctor;
-    }
-    C(const C& /*other*/) noexcept {
-        ++copy_ctor;
-    }
-    C(C&& /*other*/) noexcept {
-        ++move_ctor;
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    explicit CountingAllocator(int* allocations) noexcept
+        : allocations(allocations) {
     }
-    C& operator=(const C& other) noexcept {
-        if (this != &other) {
-            ++copy_assign;
-        }
-        return *this;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept
+        : allocations(other.allocations) {
     }
-    C& operator=(C&& /*other*/) noexcept {
-        ++move_assign;
-        return *this;
+
+    T* allocate(size_t n) {
+        ++*allocations;
+        return std::allocator<T>{}.allocate(n);
     }
-    ~C() {
-        ++dtor;
+    void deallocate(T* p, size_t n) noexcept {
+        --*allocations;
+        std::allocator<T>{}.deallocate(p, n);
     }
 
-    static void Reset() {
-        def_ctor = 0;
-        copy_ctor = 0;
-        move_ctor = 0;
-        copy_assign = 0;
-        move_assign = 0;
-        dtor = 0;
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const noexcept {
+        return allocations == other.allocations;
     }
 
-    inline static size_t def_ctor = 0;
-    inline static size_t copy_ctor = 0;
-    inline static size_t move_ctor = 0;
-    inline static size_t copy_assign = 0;
-    inline static size_t move_assign = 0;
-    inline static size_t dtor = 0;
+    int* allocations;
 };
 
-void Dump() {
-    using namespace std;
-    cerr << "Def ctors: "sv << C::def_ctor              //
-        << ", Copy ctors: "sv << C::copy_ctor          //
-        << ", Move ctors: "sv << C::move_ctor          //
-        << ", Copy assignments: "sv << C::copy_assign  //
-        << ", Move assignments: "sv << C::move_assign  //
-        << ", Dtors: "sv << C::dtor << endl;
-}
+// ,         ,    .
+//   ,     
+template <typename T>
+struct PropagatingAllocator : CountingAllocator<T> {
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
 
-void Benchmark() {
-    using namespace std;
-    try {
-        const size_t NUM = 10;
-        C c;
+    using CountingAllocator<T>::CountingAllocator;
+    template <typename U>
+    PropagatingAllocator(const PropagatingAllocator<U>& other) noexcept
+        : CountingAllocator<T>(other) {
+    }
+};
+
+void Test7() {
+    const size_t SIZE = 100;
+    const int ID = 42;
+    {
+        Obj::ResetCounters();
+        int allocations = 0;
         {
-            cerr << "std::vector:"sv << endl;
-            C::Reset();
-            vector<C> v(NUM);
-            Dump();
-            v.push_back(c);
+            CountingAllocator<Obj> alloc(&allocations);
+            Vector<Obj, CountingAllocator<Obj>> v(alloc);
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.EmplaceBack(ID);
+            }
+            assert(allocations == 1);
+            Vector<Obj, CountingAllocator<Obj>> v_copy(v);
+            assert(allocations == 2);
+            assert(v_copy.GetAllocator() == alloc);
+            Vector<Obj, CountingAllocator<Obj>> v_moved(std::move(v));
+            assert(allocations == 2);
+            assert(v.Size() == 0);
+            assert(v_moved.Size() == SIZE);
         }
-        Dump();
+        assert(allocations == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
     }
-    catch (...) {
+    {
+        //    rhs       
+        using Alloc = PropagatingAllocator<Obj>;
+        Obj::ResetCounters();
+        int first = 0;
+        int second = 0;
+        {
+            Vector<Obj, Alloc> v(Alloc{ &first });
+            v.Resize(SIZE);
+            Vector<Obj, Alloc> source(Alloc{ &second });
+            source.Resize(SIZE / 2);
+            v = source;
+            assert(v.GetAllocator() == Alloc{ &second });
+            assert(v.Size() == SIZE / 2);
+            assert(first == 0 && second == 2);
+
+            Vector<Obj, Alloc> other(Alloc{ &first });
+            other.Resize(SIZE);
+            other = std::move(v);
+            assert(other.GetAllocator() == Alloc{ &second });
+            assert(other.Size() == SIZE / 2);
+            assert(v.Size() == 0);
+            assert(first == 0 && second == 2);
+        }
+        assert(first == 0 && second == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
     }
-    try {
-        const size_t NUM = 10;
-        C c;
+    {
+        Obj::ResetCounters();
+        ArenaResource arena;
         {
-            cerr << "Vector:"sv << endl;
-            C::Reset();
-            Vector<C> v(NUM);
-            Dump();
-            v.PushBack(c);
+            PmrVector<Obj> v(&arena);
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.PushBack(Obj{ ID });
+            }
+            assert(v.GetAllocator().resource() == &arena);
+            assert(arena.BytesAllocated() >= SIZE * sizeof(Obj));
+            PmrVector<Obj> v_copy(v);
+            assert(v_copy.GetAllocator().resource() == std::pmr::get_default_resource());
+            assert(v_copy[SIZE - 1].id == ID);
+
+            //       ,   
+            PmrVector<Obj> v_other(&arena);
+            v_other = std::move(v_copy);
+            assert(v_other.GetAllocator().resource() == &arena);
+            assert(v_other.Size() == SIZE);
         }
-        Dump();
+        arena.Release();
+        assert(arena.BytesAllocated() == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        std::byte buffer[1024];
+        ArenaResource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+        PmrVector<int> v(&arena);
+        v.Reserve(16);
+        assert(reinterpret_cast<std::byte*>(&*v.begin()) >= buffer);
+        assert(reinterpret_cast<std::byte*>(&*v.begin()) < buffer + sizeof(buffer));
     }
-    catch (...) {
+    {
+        PoolResource pool;
+        std::pmr::memory_resource* resource = &pool;
+        void* a = resource->allocate(24);
+        resource->deallocate(a, 24);
+        void* b = resource->allocate(32);
+        assert(a == b);
+        resource->deallocate(b, 32);
+        assert(PoolResource::ClassSize(100) == 128);
+
+        PmrVector<std::string> v(&pool);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(std::to_string(i));
+        }
+        assert(v[SIZE - 1] == std::to_string(SIZE - 1));
+        void* big = resource->allocate(PoolResource::MAX_POOLED_SIZE * 2, 64);
+        assert(reinterpret_cast<std::uintptr_t>(big) % 64 == 0);
+        resource->deallocate(big, PoolResource::MAX_POOLED_SIZE * 2, 64);
     }
 }
 
@@ -798,7 +892,7 @@ void PrintStatement(OBJ&)
 }
 
 template<typename OBJ>
-void TestEmplaceAdditionalCopyImpl(size_t copy, size_t move) {
+void TestEmplaceAdditionalCopyImpl(size_t copy, size_t move, size_t move_assign) {
     {
         int a{ MAGIC };
         Vector <OBJ> v(SIZE);
@@ -827,14 +921,14 @@ void TestEmplaceAdditionalCopyImpl(size_t copy, size_t move) {
         assert(OBJ::copy_ctor == 0u);
         assert(OBJ::move_ctor == 1u);
         assert(OBJ::copy_assign == 0u);
-        assert(OBJ::move_assign == SIZE);
+        assert(OBJ::move_assign == move_assign);
         assert(OBJ::dtor == 1u);
         assert(OBJ::copy_with_val == 1u);
         assert(OBJ::move_with_val == 0u);
     }
 }
 template<typename OBJ>
-void TestEmplaceAdditionalMoveImpl(size_t copy, size_t move) {
+void TestEmplaceAdditionalMoveImpl(size_t copy, size_t move, size_t move_assign) {
     {
         int a{ MAGIC };
         Vector<OBJ> v(SIZE);
@@ -862,22 +956,2312 @@ void TestEmplaceAdditionalMoveImpl(size_t copy, size_t move) {
         assert(OBJ::copy_ctor == 0u);
         assert(OBJ::move_ctor == 1u);
         assert(OBJ::copy_assign == 0u);
-        assert(OBJ::move_assign == SIZE);
+        assert(OBJ::move_assign == move_assign);
         assert(OBJ::dtor == 1u);
         assert(OBJ::copy_with_val == 0u);
         assert(OBJ::move_with_val == 1u);
     }
 }
 
+//         ,  -    
 void TestEmplaceAdditional_move_noexcept_copy() {
-    TestEmplaceAdditionalCopyImpl<CC>(0u, SIZE);
-    TestEmplaceAdditionalMoveImpl<CC>(0u, SIZE);
+    TestEmplaceAdditionalCopyImpl<CC>(0u, SIZE, SIZE - 1);
+    TestEmplaceAdditionalMoveImpl<CC>(0u, SIZE, SIZE - 1);
 }
 void TestEmplaceAdditional_move_without_noexcept_copy() {
-    TestEmplaceAdditionalCopyImpl<move_without_noexcept>(SIZE, 0u);
-    TestEmplaceAdditionalMoveImpl<move_without_noexcept>(SIZE, 0u);
+    TestEmplaceAdditionalCopyImpl<move_without_noexcept>(SIZE, 0u, SIZE);
+    TestEmplaceAdditionalMoveImpl<move_without_noexcept>(SIZE, 0u, SIZE);
+}
+
+
+struct Handle {
+    explicit Handle(int id)
+        : id(new int(id)) {
+    }
+    Handle(Handle&& other) noexcept
+        : id(std::exchange(other.id, nullptr)) {
+        ++num_moved;
+    }
+    Handle& operator=(Handle&& other) noexcept {
+        std::swap(id, other.id);
+        return *this;
+    }
+    ~Handle() {
+        delete id;
+        ++num_destroyed;
+    }
+
+    static inline int num_moved = 0;
+    static inline int num_destroyed = 0;
+
+    int* id;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type {};
+
+void Test8() {
+    const int SIZE = 1000;
+    static_assert(IS_TRIVIALLY_RELOCATABLE<int>);
+    static_assert(IS_TRIVIALLY_RELOCATABLE<std::unique_ptr<int>>);
+    static_assert(!IS_TRIVIALLY_RELOCATABLE<Obj>);
+    {
+        Vector<Handle> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Reserve(SIZE * 2);
+        while (v.Size() < v.Capacity()) {
+            v.EmplaceBack(SIZE - 1);
+        }
+        v.Emplace(v.begin() + SIZE / 2, -1);
+        //        ,  
+        assert(Handle::num_moved == 0);
+        assert(Handle::num_destroyed == 0);
+        assert(*v[0].id == 0);
+        assert(*v[SIZE / 2].id == -1);
+        assert(*v[SIZE].id == SIZE - 1);
+        assert(v.Size() == SIZE * 2 + 1);
+    }
+    assert(Handle::num_destroyed == SIZE * 2 + 1);
+    {
+        Vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(std::make_unique<int>(i));
+        }
+        v.Emplace(v.begin(), std::make_unique<int>(-1));
+        assert(*v[0] == -1);
+        assert(*v[SIZE] == SIZE - 1);
+    }
+    {
+        Vector<move_without_noexcept> v_copy_fallback(SIZE);
+        move_without_noexcept::Reset();
+        v_copy_fallback.EmplaceBack();
+        assert(move_without_noexcept::copy_ctor == SIZE);
+        assert(move_without_noexcept::move_ctor == 0u);
+        assert(move_without_noexcept::dtor == SIZE);
+    }
+}
+
+
+void Test9() {
+    const int SIZE = 100'000;
+    {
+        Vector<int, ReallocAllocator<int>> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        v.Emplace(v.begin(), -1);
+        assert(v.Size() == SIZE + 1);
+        assert(v[0] == -1);
+        assert(v[SIZE] == SIZE - 1);
+
+        //     mmap    mremap
+        const size_t huge = ReallocAllocator<int>::MMAP_THRESHOLD / sizeof(int);
+        v.Reserve(huge);
+        v.Reserve(huge * 2);
+        assert(v.Capacity() == huge * 2);
+        assert(v[SIZE] == SIZE - 1);
+        v.Resize(SIZE);
+        v.Reserve(huge * 4);
+        assert(v[SIZE - 1] == SIZE - 2);
+    }
+    {
+        Obj::ResetCounters();
+        ArenaResource arena(64 * 1024);
+        {
+            Vector<Obj, ArenaAllocator<Obj>> v(&arena);
+            v.EmplaceBack(1);
+            const Obj* first = &v[0];
+            for (int i = 0; i < 100; ++i) {
+                v.EmplaceBack(i);
+            }
+            //           
+            assert(&v[0] == first);
+            assert(Obj::num_moved == 0);
+            assert(Obj::num_copied == 0);
+            v.Emplace(v.begin() + 1, 2);
+            assert(v[1].id == 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+
+template <typename Policy>
+size_t CountReallocations(size_t count) {
+    Vector<int, std::allocator<int>, Policy> v;
+    size_t reallocations = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t old_capacity = v.Capacity();
+        v.PushBack(static_cast<int>(i));
+        reallocations += v.Capacity() != old_capacity ? 1 : 0;
+    }
+    return reallocations;
+}
+
+void Test10() {
+    static_assert(DoublingGrowth::NextCapacity<int>(0, 1) == 1);
+    static_assert(DoublingGrowth::NextCapacity<int>(8, 9) == 16);
+    static_assert(OneAndHalfGrowth::NextCapacity<int>(0, 1) == 1);
+    static_assert(OneAndHalfGrowth::NextCapacity<int>(10, 11) == 16);
+    static_assert(MinCapacityGrowth<16>::NextCapacity<int>(0, 1) == 16);
+    static_assert(MinCapacityGrowth<16>::NextCapacity<int>(16, 17) == 32);
+    static_assert(MinBytesGrowth<64>::NextCapacity<double>(0, 1) == 8);
+    static_assert(SizeClassGrowth<>::NextCapacity<char[24]>(2, 3) == 5);
+    static_assert(SizeClassGrowth<>::NextCapacity<char>(4096, 4097) == 8192);
+    static_assert(SizeClassGrowth<OneAndHalfGrowth>::NextCapacity<char>(5000, 5001) == 8192);
+
+    const size_t COUNT = 1000;
+    assert(CountReallocations<DoublingGrowth>(COUNT) == 11);
+    assert(CountReallocations<MinCapacityGrowth<16>>(COUNT) == 7);
+    assert(CountReallocations<OneAndHalfGrowth>(COUNT) > CountReallocations<DoublingGrowth>(COUNT));
+    {
+        Vector<Obj, std::allocator<Obj>, MinBytesGrowth<256>> v;
+        v.EmplaceBack(1);
+        assert(v.Capacity() == (256 + sizeof(Obj) - 1) / sizeof(Obj));
+        v.Emplace(v.begin(), 2);
+        assert(v[0].id == 2);
+        assert(v[1].id == 1);
+    }
+}
+
+
+void Test11() {
+    const int ID = 42;
+    using namespace std::literals;
+    {
+        Obj::ResetCounters();
+        int allocations = 0;
+        {
+            using Small = SmallVector<Obj, 4, CountingAllocator<Obj>>;
+            Small v{ CountingAllocator<Obj>(&allocations) };
+            for (int i = 0; i < 4; ++i) {
+                v.EmplaceBack(i);
+            }
+            assert(v.IsInline());
+            assert(allocations == 0);
+            v.Emplace(v.begin() + 1, ID, "Ivan"s);
+            assert(!v.IsInline());
+            assert(allocations == 1);
+            assert(v.Size() == 5);
+            assert(v.Capacity() == 8);
+            assert(v[1].id == ID && v[1].name == "Ivan"s);
+            assert(v[4].id == 3);
+            v.Erase(v.begin());
+            assert(v[0].id == ID);
+            assert(Obj::GetAliveObjectCount() == 4);
+        }
+        assert(allocations == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        Obj::ResetCounters();
+        SmallVector<Obj, 4> inline_v(2);
+        inline_v[1].id = ID;
+        SmallVector<Obj, 4> heap_v(10);
+        heap_v[9].id = ID + 1;
+
+        SmallVector<Obj, 4> inline_copy(inline_v);
+        assert(inline_copy.IsInline() && inline_copy[1].id == ID);
+        SmallVector<Obj, 4> heap_copy(heap_v);
+        assert(!heap_copy.IsInline() && heap_copy[9].id == ID + 1);
+
+        inline_copy.Swap(heap_copy);
+        assert(inline_copy.Size() == 10 && inline_copy[9].id == ID + 1);
+        assert(heap_copy.Size() == 2 && heap_copy[1].id == ID);
+
+        const Obj* heap_data = &heap_v[0];
+        SmallVector<Obj, 4> moved_heap(std::move(heap_v));
+        assert(&moved_heap[0] == heap_data);
+        assert(heap_v.Size() == 0 && heap_v.IsInline());
+        SmallVector<Obj, 4> moved_inline(std::move(inline_v));
+        assert(moved_inline.IsInline() && moved_inline[1].id == ID);
+
+        moved_heap = moved_inline;
+        assert(moved_heap.Size() == 2 && moved_heap[1].id == ID);
+        moved_inline = std::move(inline_copy);
+        assert(moved_inline.Size() == 10 && !moved_inline.IsInline());
+        assert(Obj::GetAliveObjectCount() == 2 + 2 + 10);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        SmallVector<std::string, 2> v;
+        v.Resize(3);
+        assert(v.Size() == 3 && v[2].empty());
+        v.Resize(1);
+        v.Reserve(16);
+        assert(v.Capacity() == 16);
+        v.PushBack("a"s);
+        v.Insert(v.begin(), v[1]);
+        assert(v[0] == "a"s && v[2] == "a"s);
+        v.PopBack();
+        assert(v.Back().empty());
+        assert(std::distance(v.begin(), v.end()) == 2);
+    }
+    {
+        //       pmr  :     
+        using PmrSmall = SmallVector<std::string, 2, std::pmr::polymorphic_allocator<std::string>>;
+        ArenaResource left_arena;
+        ArenaResource right_arena;
+        PmrSmall left(&left_arena);
+        PmrSmall right(&right_arena);
+        for (int i = 0; i < 10; ++i) {
+            right.PushBack(std::to_string(i));
+        }
+        left = std::move(right);
+        assert(left.GetAllocator().resource() == &left_arena && left.Size() == 10 && left[9] == "9"s);
+        assert(right.Size() == 0 && right.GetAllocator().resource() == &right_arena);
+
+        PmrSmall heap(&right_arena);
+        for (int i = 0; i < 5; ++i) {
+            heap.PushBack(std::to_string(-i));
+        }
+        PmrSmall small(&left_arena);
+        small.PushBack("s"s);
+        left.Swap(heap);
+        assert(left.GetAllocator().resource() == &left_arena && left.Size() == 5 && left[4] == "-4"s);
+        assert(heap.GetAllocator().resource() == &right_arena && heap.Size() == 10 && heap[9] == "9"s);
+        small.Swap(heap);
+        assert(small.Size() == 10 && small[0] == "0"s && small.GetAllocator().resource() == &left_arena);
+        assert(heap.Size() == 1 && heap[0] == "s"s && heap.GetAllocator().resource() == &right_arena);
+
+        left = heap;
+        assert(left.Size() == 1 && left[0] == "s"s && left.GetAllocator().resource() == &left_arena);
+        heap = small;
+        assert(heap.Size() == 10 && heap.GetAllocator().resource() == &right_arena);
+    }
+    {
+        //           
+        using Alloc = PropagatingAllocator<std::string>;
+        using Propagating = SmallVector<std::string, 2, Alloc>;
+        int left_count = 0;
+        int right_count = 0;
+        {
+            Propagating left(Alloc{ &left_count });
+            Propagating right(Alloc{ &right_count });
+            for (int i = 0; i < 5; ++i) {
+                right.PushBack(std::to_string(i));
+                left.PushBack("x"s);
+            }
+            left = right;
+            assert(left.GetAllocator() == Alloc{ &right_count } && left.Size() == 5 && left[4] == "4"s);
+            assert(left_count == 0 && right_count == 2);
+
+            Propagating moved(Alloc{ &left_count });
+            for (int i = 0; i < 5; ++i) {
+                moved.PushBack("y"s);
+            }
+            moved = std::move(right);
+            assert(moved.GetAllocator() == Alloc{ &right_count } && moved.Size() == 5 && right.Size() == 0);
+            assert(left_count == 0 && right_count == 2);
+
+            Propagating inline_source(Alloc{ &left_count });
+            inline_source.PushBack("i"s);
+            moved = std::move(inline_source);
+            assert(moved.GetAllocator() == Alloc{ &left_count } && moved.Size() == 1 && moved[0] == "i"s);
+            left = moved;
+            assert(left.GetAllocator() == Alloc{ &left_count } && left.Size() == 1);
+            assert(left_count == 0 && right_count == 0);
+        }
+        assert(left_count == 0 && right_count == 0);
+    }
+}
+
+
+template <typename V>
+std::vector<int> Ids(const V& v) {
+    std::vector<int> ids;
+    for (const auto& obj : v) {
+        ids.push_back(obj.id);
+    }
+    return ids;
+}
+
+void Test12() {
+    const std::vector<int> source{ 1, 2, 3, 4 };
+    {
+        //        
+        Vector<int> v(3);
+        std::iota(v.begin(), v.end(), 10);
+        auto* pos = v.Insert(v.cbegin() + 1, source.begin(), source.end());
+        assert(pos == &v[1]);
+        assert(std::vector<int>(v.begin(), v.end()) == (std::vector<int>{ 10, 1, 2, 3, 4, 11, 12 }));
+        assert(v.Capacity() == 7);
+        v.Insert(v.cend(), 2, 0);
+        v.Insert(v.cbegin(), 1, v[1]);
+        assert(std::vector<int>(v.begin(), v.end()) == (std::vector<int>{ 1, 10, 1, 2, 3, 4, 11, 12, 0, 0 }));
+        v.Erase(v.cbegin() + 1, v.cbegin() + 6);
+        assert(std::vector<int>(v.begin(), v.end()) == (std::vector<int>{ 1, 11, 12, 0, 0 }));
+        v.Append(source);
+        assert(v.Size() == 9 && v[8] == 4);
+        std::istringstream input("7 8 9");
+        v.Insert(v.cbegin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert(v[1] == 7 && v[3] == 9 && v[4] == 11);
+    }
+    {
+        //   :      
+        Obj::ResetCounters();
+        std::list<Obj> objs;
+        for (int id : source) {
+            objs.emplace_back(id);
+        }
+        Vector<Obj> v;
+        v.Reserve(20);
+        for (int id = 10; id < 16; ++id) {
+            v.EmplaceBack(id);
+        }
+        v.Insert(v.cbegin() + 1, objs.begin(), objs.end());
+        assert(Ids(v) == (std::vector<int>{ 10, 1, 2, 3, 4, 11, 12, 13, 14, 15 }));
+        v.Insert(v.cbegin() + 8, objs.begin(), objs.end());
+        assert(Ids(v) == (std::vector<int>{ 10, 1, 2, 3, 4, 11, 12, 13, 1, 2, 3, 4, 14, 15 }));
+        assert(v.Capacity() == 20);
+        v.Erase(v.cbegin(), v.cbegin() + 5);
+        assert(Ids(v) == (std::vector<int>{ 11, 12, 13, 1, 2, 3, 4, 14, 15 }));
+        v.Erase(v.cbegin() + 3, v.cend());
+        assert(Ids(v) == (std::vector<int>{ 11, 12, 13 }));
+        assert(Obj::GetAliveObjectCount() == 3 + 4);
+
+        v.Assign(objs.begin(), objs.end());
+        assert(Ids(v) == source);
+        v.Assign(objs.begin(), std::next(objs.begin()));
+        assert(Ids(v) == (std::vector<int>{ 1 }));
+        std::vector<Obj> many(30);
+        v.Assign(many.begin(), many.end());
+        assert(v.Size() == 30 && v.Capacity() == 30);
+        std::istringstream input("1 2");
+        Vector<int> ints(5);
+        ints.Assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert(ints.Size() == 2 && ints[1] == 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        //         
+        Obj::ResetCounters();
+        std::vector<Obj> objs(3);
+        objs[2].throw_on_copy = true;
+        Vector<Obj> v(2);
+        v[0].id = 1;
+        try {
+            v.Insert(v.cbegin() + 1, objs.begin(), objs.end());
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 2 && v.Capacity() == 2 && v[0].id == 1);
+        assert(Obj::GetAliveObjectCount() == 5);
+    }
+}
+
+
+void Test13() {
+    const size_t SIZE = 1000;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE, default_init);
+        assert(v.Size() == SIZE);
+        assert(Obj::num_default_constructed == SIZE);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v(SIZE, default_init);
+        v[SIZE - 1] = 1;
+        v.ResizeDefaultInit(SIZE / 2);
+        assert(v.Size() == SIZE / 2);
+        v.ResizeDefaultInit(SIZE * 2);
+        assert(v.Size() == SIZE * 2);
+
+        // Resize     ,      
+        Vector<int> w;
+        w.Reserve(SIZE);
+        w.Resize(10);
+        assert(std::all_of(w.begin(), w.end(), [](int x) {
+            return x == 0;
+            }));
+        w[9] = 9;
+        w.Resize(20);
+        assert(w[9] == 9 && w[19] == 0);
+    }
+    {
+        const std::string payload = "hello";
+        Vector<char> buffer;
+        buffer.ResizeAndOverwrite(64, [&payload](char* data, size_t size) {
+            assert(size == 64);
+            std::copy(payload.begin(), payload.end(), data);
+            return payload.size();
+            });
+        assert(buffer.Size() == payload.size());
+        assert(buffer.Capacity() == 64);
+        assert(std::string(buffer.begin(), buffer.end()) == payload);
+        try {
+            buffer.ResizeAndOverwrite(128, [](char*, size_t) -> size_t {
+                throw std::runtime_error("Oops");
+                });
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(buffer.Size() == payload.size());
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(2);
+        v.ResizeAndOverwrite(10, [](Obj* data, size_t) {
+            data[2].id = 42;
+            return 3;
+            });
+        assert(v.Size() == 3 && v[2].id == 42);
+        assert(Obj::GetAliveObjectCount() == 3);
+    }
+}
+
+struct GrowthStatsTag {
+    static constexpr std::string_view NAME = "growth"sv;
+};
+
+struct CopyStatsTag {
+};
+
+struct ExpandStatsTag {
+};
+
+void Test14() {
+    using Instrumented = InstrumentedVector<int, GrowthStatsTag>;
+    using Stats = CountingInstrumentation<GrowthStatsTag>;
+    Stats::Reset();
+    {
+        Instrumented v;
+        for (int i = 0; i < 17; ++i) {
+            v.PushBack(i);
+        }
+        //   1, 2, 4, 8, 16, 32
+        const VectorStats stats = Stats::Snapshot();
+        assert(stats.allocations == 6);
+        assert(stats.growth_reallocations == 6);
+        assert(stats.bytes_allocated == (1 + 2 + 4 + 8 + 16 + 32) * sizeof(int));
+        assert(stats.elements_relocated == 1 + 2 + 4 + 8 + 16);
+        assert(stats.elements_moved == 0 && stats.elements_copied == 0);
+        assert(stats.peak_capacity == 32);
+
+        Instrumented copy(v);
+        assert(Stats::Snapshot().allocations == 7);
+    }
+    {
+        using CopyStats = CountingInstrumentation<CopyStatsTag>;
+        CopyStats::Reset();
+        // Obj   noexcept, WithCopy<false>    
+        Vector<Obj, std::allocator<Obj>, DoublingGrowth, CopyStats> objects(2);
+        objects.Reserve(4);
+        Vector<WithCopy<false>, std::allocator<WithCopy<false>>, DoublingGrowth, CopyStats> copies(3);
+        copies.Reserve(6);
+        const VectorStats stats = CopyStats::Snapshot();
+        assert(stats.allocations == 4);
+        assert(stats.growth_reallocations == 0);
+        assert(stats.elements_moved == 2 && stats.elements_copied == 3);
+        assert(stats.peak_capacity == 6);
+    }
+    {
+        using ExpandStats = CountingInstrumentation<ExpandStatsTag>;
+        ExpandStats::Reset();
+        //        :      
+        const size_t huge = ReallocAllocator<int>::MMAP_THRESHOLD / sizeof(int);
+        Vector<int, ReallocAllocator<int>, DoublingGrowth, ExpandStats> v;
+        v.Reserve(huge + 1);
+        v.Resize(huge + 1);
+        const int* data = &v[0];
+        v.Reserve(huge + 2);
+        v.PushBack(1);
+        assert(&v[0] == data && v.Capacity() == huge + 2);
+        const VectorStats stats = ExpandStats::Snapshot();
+        assert(stats.allocations == 1 && stats.bytes_allocated == (huge + 1) * sizeof(int));
+        assert(stats.in_place_expansions == 1 && stats.bytes_expanded == sizeof(int));
+        assert(stats.growth_reallocations == 0 && stats.elements_relocated == 0);
+        assert(stats.peak_capacity == huge + 2);
+    }
+    bool found = false;
+    VectorStatsRegistry::ForEach([&found](std::string_view name, const VectorStats& stats) {
+        if (name == "growth"sv) {
+            found = true;
+            assert(stats.allocations == 7);
+        }
+        });
+    assert(found);
 }
 
+//  ,      throw_countdown- 
+struct ThrowingMoveOnly {
+    explicit ThrowingMoveOnly(int v) : value(std::make_unique<int>(v)) {
+    }
+    ThrowingMoveOnly(ThrowingMoveOnly&& other) noexcept(false) : value(std::move(other.value)) {
+        if (--throw_countdown == 0) {
+            throw std::runtime_error("move");
+        }
+    }
+    std::unique_ptr<int> value;
+    inline static int throw_countdown = 0;
+};
+
+void Test15() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Resize(SIZE / 10);
+        assert(v.Capacity() == SIZE);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE / 10 && v.Size() == SIZE / 10);
+        assert(Obj::GetAliveObjectCount() == SIZE / 10);
+        v.Clear();
+        assert(v.Size() == 0 && v.Capacity() == SIZE / 10);
+        assert(Obj::GetAliveObjectCount() == 0);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0 && v.begin() == nullptr);
+    }
+    {
+        Vector<int, std::allocator<int>, AutoShrink<>> v(SIZE);
+        v.Resize(SIZE / 4);
+        assert(v.Capacity() == SIZE);
+        v.PopBack();
+        assert(v.Capacity() == (SIZE / 4 - 1) * 2);
+        //       ,   
+        const size_t capacity = v.Capacity();
+        v.Erase(v.cbegin(), v.cbegin() + 10);
+        assert(v.Capacity() == capacity);
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+            v.PopBack();
+        }
+        assert(v.Capacity() == capacity);
+        v.Clear();
+        assert(v.Capacity() == 0);
+    }
+    {
+        //          :
+        //       
+        Vector<ThrowingMoveOnly, std::allocator<ThrowingMoveOnly>, AutoShrink<>> v;
+        v.Reserve(SIZE);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+        ThrowingMoveOnly::throw_countdown = 2;
+        v.PopBack();
+        assert(v.Capacity() == SIZE && v.Size() == 3 && *v[0].value == 0 && *v[2].value == 2);
+        ThrowingMoveOnly::throw_countdown = 0;
+
+        Vector<WithCopy<false>, std::allocator<WithCopy<false>>, AutoShrink<>> copies(SIZE);
+        copies.Resize(3);
+        assert(copies.Capacity() == 6);
+    }
+}
+
+void Test16() {
+    const int SIZE = 10;
+    {
+        //     
+        Vector<std::string> v;
+        v.Reserve(SIZE * 2);
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(std::string(32, static_cast<char>('a' + i)));
+        }
+        v.Emplace(v.cbegin() + 1, v[5]);
+        assert(v.Size() == SIZE + 1 && v.Capacity() == SIZE * 2);
+        assert(v[1] == std::string(32, 'f') && v[6] == std::string(32, 'f'));
+        assert(v[2] == std::string(32, 'b'));
+    }
+    {
+        //   :    
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.Reserve(SIZE * 2);
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(i);
+        }
+        Obj bad;
+        bad.throw_on_copy = true;
+        try {
+            v.Emplace(v.cbegin() + 3, bad);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == SIZE);
+        for (int i = 0; i < SIZE; ++i) {
+            assert(v[i].id == i);
+        }
+        assert(Obj::GetAliveObjectCount() == SIZE + 1);
+    }
+    {
+        Vector<std::unique_ptr<int>> v;
+        v.Reserve(SIZE * 2);
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(std::make_unique<int>(i));
+        }
+        v.Emplace(v.cbegin() + 4, std::make_unique<int>(-1));
+        assert(*v[3] == 3 && *v[4] == -1 && *v[5] == 4 && *v[SIZE] == SIZE - 1);
+        v.Emplace(v.cend(), std::make_unique<int>(SIZE));
+        assert(*v.Back() == SIZE && v.Size() == SIZE + 2);
+    }
+    {
+        //   noexcept,     
+        struct Name {
+            explicit Name(std::string v) : value(std::move(v)) {
+            }
+            Name(Name&&) noexcept = default;
+            Name(const Name&) = default;
+            Name& operator=(Name&& other) noexcept(false) {
+                value = std::move(other.value);
+                return *this;
+            }
+            Name& operator=(const Name&) = default;
+            std::string value;
+        };
+        Vector<Name> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(std::to_string(i));
+        }
+        v.Emplace(v.cbegin() + 2, "x"s);
+        v.Insert(v.cbegin(), Name("y"s));
+        assert(v.Size() == SIZE + 2 && v[0].value == "y"s && v[3].value == "x"s && v[4].value == "2"s);
+    }
+}
+
+//              
+template <typename T>
+void TestSimdKernels() {
+    SimdVector<T> data(300);
+    for (size_t i = 0; i < data.Size(); ++i) {
+        data[i] = static_cast<T>((i * 37) % 101) - static_cast<T>(50);
+    }
+    assert(reinterpret_cast<std::uintptr_t>(data.begin()) % 64 == 0);
+    const SimdLevel detected = DetectSimdLevel();
+    for (size_t offset = 0; offset < 5; ++offset) {
+        for (size_t n : { size_t{ 1 }, size_t{ 7 }, size_t{ 64 }, size_t{ 295 } }) {
+            const T* first = data.begin() + offset;
+            SetSimdLevel(SimdLevel::Scalar);
+            const size_t find = Find(first, n, static_cast<T>(50));
+            const size_t count = Count(first, n, static_cast<T>(-50));
+            const auto sum = Sum(first, n);
+            const auto minmax = MinMax(first, n);
+            for (SimdLevel level : { SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512 }) {
+                if (level > detected) {
+                    continue;
+                }
+                SetSimdLevel(level);
+                assert(Find(first, n, static_cast<T>(50)) == find);
+                assert(Count(first, n, static_cast<T>(-50)) == count);
+                assert(Sum(first, n) == sum);
+                assert(MinMax(first, n) == minmax);
+            }
+        }
+    }
+    SetSimdLevel(detected);
+}
+
+void Test17() {
+    TestSimdKernels<float>();
+    TestSimdKernels<double>();
+    TestSimdKernels<int32_t>();
+    TestSimdKernels<int64_t>();
+    TestSimdKernels<uint8_t>();
+    {
+        Vector<float> v(100);
+        Fill(v, 1.5f);
+        assert(std::all_of(v.begin(), v.end(), [](float x) {
+            return x == 1.5f;
+            }));
+        assert(Sum(v) == 150.0f);
+        v[42] = -3.0f;
+        v[77] = 9.0f;
+        assert(Find(v, -3.0f) == v.begin() + 42);
+        assert(Find(v, 2.0f) == v.end());
+        assert(Count(v, 1.5f) == 98);
+        assert(MinMax(v) == std::make_pair(-3.0f, 9.0f));
+        Vector<int32_t> rounded(v.Size());
+        Transform(v, rounded, [](float x) {
+            return static_cast<int32_t>(x * 2);
+            });
+        assert(rounded[42] == -6 && rounded[0] == 3);
+    }
+    {
+        //  32-   
+        SimdVector<int32_t> v(1000);
+        Fill(v, std::numeric_limits<int32_t>::max());
+        assert(Sum(v) == int64_t{ 1000 } * std::numeric_limits<int32_t>::max());
+        SmallVector<int64_t, 8> small(5);
+        Fill(small, 7);
+        assert(Sum(small) == 35);
+    }
+}
+
+struct alignas(128) Wide {
+    Wide() = default;
+    explicit Wide(int value)
+        : value(value) {
+    }
+    int value = 0;
+};
+
+template <typename Container>
+bool IsAligned(const Container& c, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(c.begin()) % alignment == 0;
+}
+
+void Test18() {
+    {
+        //        
+        Vector<Wide> v;
+        SmallVector<Wide, 2> small;
+        ArenaResource arena(100);
+        PmrVector<Wide> arena_vector(&arena);
+        PoolResource pool;
+        PmrVector<Wide> pool_vector(&pool);
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(i);
+            small.EmplaceBack(i);
+            arena_vector.EmplaceBack(i);
+            pool_vector.EmplaceBack(i);
+            assert(IsAligned(v, alignof(Wide)) && IsAligned(small, alignof(Wide)));
+            assert(IsAligned(arena_vector, alignof(Wide)) && IsAligned(pool_vector, alignof(Wide)));
+        }
+        assert(v[99].value == 99 && small[99].value == 99);
+    }
+    {
+        Vector<char, AlignedAllocator<char>> line(1);
+        assert(IsAligned(line, CACHE_LINE_SIZE));
+        Vector<int, AlignedAllocator<int, 4096>> page(10);
+        assert(IsAligned(page, 4096));
+        page.Reserve(5000);
+        assert(IsAligned(page, 4096));
+    }
+    {
+        using Allocator = HugePageAllocator<int64_t>;
+        const size_t huge = Allocator::HUGE_PAGE_SIZE / sizeof(int64_t);
+        Vector<int64_t, Allocator> small(10);
+        assert(IsAligned(small, CACHE_LINE_SIZE));
+        Vector<int64_t, Allocator> v(huge + 1);
+        assert(IsAligned(v, Allocator::HUGE_PAGE_SIZE));
+        v[huge] = 42;
+        //         
+        const int64_t* data = v.begin();
+        v.Reserve(huge * 2);
+        assert(v.begin() == data && v[huge] == 42);
+        v.Reserve(huge * 8);
+        assert(IsAligned(v, Allocator::HUGE_PAGE_SIZE) && v[huge] == 42);
+    }
+}
+
+//  :       
+struct ParallelObj {
+    ParallelObj() {
+        if (default_construction_throw_countdown.fetch_sub(1) == 1) {
+            throw std::runtime_error("Oops");
+        }
+        ++alive;
+    }
+    explicit ParallelObj(int id)
+        : id(id) {
+        ++alive;
+    }
+    ParallelObj(const ParallelObj& other)
+        : id(other.id) {
+        if (other.id == throw_on_copy_id) {
+            throw std::runtime_error("Oops");
+        }
+        ++alive;
+    }
+    ParallelObj& operator=(const ParallelObj& other) = default;
+    ~ParallelObj() {
+        --alive;
+    }
+
+    int id = 0;
+
+    static inline std::atomic<int> alive = 0;
+    static inline std::atomic<int> default_construction_throw_countdown = 0;
+    static inline int throw_on_copy_id = -1;
+};
+
+void Test19() {
+    const size_t SIZE = 10'000;
+    const parallel_t policy{ 4, 100 };
+    {
+        Vector<ParallelObj> v(policy, SIZE);
+        assert(v.Size() == SIZE && ParallelObj::alive == static_cast<int>(SIZE));
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i].id = static_cast<int>(i);
+        }
+        Vector<ParallelObj> copy(policy, v);
+        assert(copy.Size() == SIZE && copy[SIZE - 1].id == static_cast<int>(SIZE - 1));
+        assert(ParallelObj::alive == static_cast<int>(SIZE * 2));
+
+        Vector<ParallelObj> small(policy, SIZE / 2);
+        small.Reserve(SIZE);
+        small.Assign(policy, v);
+        assert(small.Size() == SIZE && small[SIZE / 2].id == static_cast<int>(SIZE / 2));
+        copy.Resize(SIZE / 3);
+        small.Assign(policy, copy);
+        assert(small.Size() == SIZE / 3 && small[SIZE / 3 - 1].id == static_cast<int>(SIZE / 3 - 1));
+        copy.Clear(policy);
+        assert(copy.Size() == 0);
+        assert(ParallelObj::alive == static_cast<int>(SIZE + SIZE / 3));
+    }
+    assert(ParallelObj::alive == 0);
+    {
+        //      ,    
+        using Alloc = PropagatingAllocator<ParallelObj>;
+        int left_count = 0;
+        int right_count = 0;
+        {
+            Vector<ParallelObj, Alloc> source(policy, SIZE, Alloc{ &right_count });
+            source[SIZE - 1].id = 7;
+            Vector<ParallelObj, Alloc> target(policy, SIZE / 2, Alloc{ &left_count });
+            target.Assign(policy, source);
+            assert(target.GetAllocator() == Alloc{ &right_count });
+            assert(target.Size() == SIZE && target[SIZE - 1].id == 7);
+            assert(left_count == 0 && right_count == 2);
+        }
+        assert(left_count == 0 && right_count == 0);
+    }
+    assert(ParallelObj::alive == 0);
+    {
+        //     :     
+        ParallelObj::default_construction_throw_countdown = static_cast<int>(SIZE) * 3 / 4;
+        try {
+            Vector<ParallelObj> v(policy, SIZE);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        ParallelObj::default_construction_throw_countdown = 0;
+        assert(ParallelObj::alive == 0);
+
+        Vector<ParallelObj> source;
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            source.EmplaceBack(i);
+        }
+        ParallelObj::throw_on_copy_id = static_cast<int>(SIZE) / 3;
+        try {
+            Vector<ParallelObj> copy(policy, source);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        ParallelObj::throw_on_copy_id = -1;
+        assert(ParallelObj::alive == static_cast<int>(SIZE));
+    }
+    {
+        Vector<int> v(parallel, 100);
+        assert(std::all_of(v.begin(), v.end(), [](int x) {
+            return x == 0;
+            }));
+    }
+}
+
+struct Record {
+    int64_t id;
+    double price;
+    char tag[8];
+};
+
+void Test20() {
+    const std::string path = (std::filesystem::temp_directory_path()
+        / ("mapped_vector_test_" + std::to_string(getpid()) + ".bin")).string();
+    const size_t SIZE = 10'000;
+    {
+        auto v = MappedVector<Record>::Create(path);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(Record{ static_cast<int64_t>(i), i * 0.5, "rec" });
+        }
+        assert(v.Size() == SIZE && v.Capacity() >= SIZE);
+        v.EmplaceBack(v[0]);
+        v.PopBack();
+    }
+    {
+        //      
+        const auto v = MappedVector<Record>::Open(path, MappedVector<Record>::Mode::ReadOnly);
+        assert(v.IsReadOnly() && v.Size() == SIZE);
+        assert(v[SIZE - 1].id == static_cast<int64_t>(SIZE - 1) && v[10].price == 5.0);
+        assert(std::string(v[3].tag) == "rec"s);
+    }
+    {
+        auto v = MappedVector<Record>::Open(path);
+        v.Resize(SIZE * 3);
+        assert(v[SIZE * 2].id == 0);
+        v[SIZE * 2].id = 42;
+        v.Resize(SIZE + 1);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE + 1);
+        v.Flush();
+        auto moved = std::move(v);
+        assert(!v.IsOpen() && moved[SIZE].id == 0 && moved[SIZE - 1].id == static_cast<int64_t>(SIZE - 1));
+    }
+    {
+        auto v = MappedVector<Record>::Open(path);
+        assert(v.Size() == SIZE + 1);
+        bool thrown = false;
+        try {
+            MappedVector<int32_t>::Open(path);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::filesystem::remove(path);
+}
+
+struct Point {
+    int x = 0;
+    string label;
+};
+
+template <>
+struct VectorCodec<Point> {
+    static void Encode(VectorWriter& out, const Point& p) {
+        out.Write(p.x);
+        VectorCodec<string>::Encode(out, p.label);
+    }
+    static Point Decode(VectorReader& in) {
+        Point p;
+        p.x = in.Read<int>();
+        p.label = VectorCodec<string>::Decode(in);
+        return p;
+    }
+};
+
+void Test21() {
+    const size_t SIZE = 100'000;
+    Vector<int64_t> numbers(SIZE, default_init);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    //    ,      
+    Vector<string> strings;
+    for (size_t i = 0; i < 10'000; ++i) {
+        strings.PushBack(to_string(i));
+    }
+    strings.PushBack(string(VectorWriter::CHUNK_SIZE * 2 + 7, 'x'));
+    strings.PushBack(""s);
+    Vector<Point> points;
+    points.PushBack(Point{ 1, "one"s });
+    points.PushBack(Point{ -2, "minus two"s });
+
+    {
+        //      
+        std::stringstream stream;
+        WriteTo(stream, numbers);
+        WriteTo(stream, strings);
+        WriteTo(stream, points);
+        WriteTo(stream, Vector<int64_t>{});
+
+        Vector<int64_t> numbers_read;
+        ReadFrom(stream, numbers_read);
+        assert(numbers_read.Size() == SIZE && numbers_read.Capacity() == SIZE);
+        assert(std::equal(numbers.begin(), numbers.end(), numbers_read.begin()));
+        Vector<string> strings_read(3);
+        ReadFrom(stream, strings_read);
+        assert(std::equal(strings.begin(), strings.end(), strings_read.begin(), strings_read.end()));
+        Vector<Point> points_read;
+        ReadFrom(stream, points_read);
+        assert(points_read.Size() == 2 && points_read[1].x == -2 && points_read[1].label == "minus two"s);
+        ReadFrom(stream, numbers_read);
+        assert(numbers_read.Size() == 0);
+        assert(stream.peek() == std::char_traits<char>::eof());
+    }
+    {
+        const std::string path = (std::filesystem::temp_directory_path()
+            / ("vector_io_test_" + std::to_string(getpid()) + ".bin")).string();
+        const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        WriteTo(fd, numbers);
+        WriteTo(fd, strings);
+        lseek(fd, 0, SEEK_SET);
+        Vector<int64_t> numbers_read;
+        ReadFrom(fd, numbers_read);
+        assert(numbers_read.Size() == SIZE && numbers_read[SIZE - 1] == static_cast<int64_t>(SIZE - 1));
+        Vector<string> strings_read;
+        ReadFrom(fd, strings_read);
+        assert(strings_read.Size() == strings.Size() && strings_read[10'000] == strings[10'000]);
+
+        //      ;       
+        lseek(fd, 0, SEEK_SET);
+        Vector<int32_t> wrong(3);
+        bool thrown = false;
+        try {
+            ReadFrom(fd, wrong);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && wrong.Size() == 0);
+        close(fd);
+        std::filesystem::remove(path);
+    }
+    {
+        std::stringstream stream;
+        WriteTo(stream, strings);
+        std::string bytes = stream.str();
+        bytes.resize(bytes.size() / 2);
+        std::istringstream truncated(bytes);
+        Vector<string> strings_read;
+        bool thrown = false;
+        try {
+            ReadFrom(truncated, strings_read);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && strings_read.Size() == 0);
+
+        std::istringstream no_header(bytes.substr(0, 3));
+        strings_read.PushBack("old"s);
+        thrown = false;
+        try {
+            ReadFrom(no_header, strings_read);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && strings_read.Size() == 0);
+    }
+}
+
+void Test22() {
+    const int THREADS = 4;
+    const int PER_THREAD = 5'000;
+    {
+        ConcurrentVector<int64_t> v;
+        std::vector<std::thread> threads;
+        std::vector<const int64_t*> firsts(THREADS);
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&v, &firsts, t] {
+                for (int i = 0; i < PER_THREAD; ++i) {
+                    const int64_t& ref = v.EmplaceBack(t * PER_THREAD + i);
+                    if (i == 0) {
+                        firsts[t] = &ref;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        assert(v.Size() == THREADS * PER_THREAD);
+        //     
+        for (int t = 0; t < THREADS; ++t) {
+            assert(*firsts[t] == t * PER_THREAD);
+        }
+        Vector<int64_t> frozen = v.Freeze();
+        assert(v.Size() == 0 && frozen.Size() == THREADS * PER_THREAD);
+        std::sort(frozen.begin(), frozen.end());
+        for (size_t i = 0; i < frozen.Size(); ++i) {
+            assert(frozen[i] == static_cast<int64_t>(i));
+        }
+    }
+    {
+        //     : Freeze    
+        ConcurrentVector<string> v(1000);
+        const string* first = &v.EmplaceBack("first"s);
+        for (int i = 0; i < 999; ++i) {
+            v.PushBack(to_string(i));
+        }
+        Vector<string> frozen = v.Freeze();
+        assert(frozen.Capacity() == 1024 && &frozen[0] == first && frozen[999] == "998"s);
+
+        for (int i = 0; i < 2000; ++i) {
+            v.PushBack(to_string(i));
+        }
+        frozen = v.Freeze();
+        assert(frozen.Size() == 2000 && frozen.Capacity() == 2000 && frozen[1999] == "1999"s);
+    }
+    {
+        // ,    , 
+        ConcurrentVector<ParallelObj> v;
+        v.Reserve(100);
+        for (int i = 0; i < 100; ++i) {
+            if (i % 10 == 0) {
+                ParallelObj::default_construction_throw_countdown = 1;
+                try {
+                    v.EmplaceBack();
+                    assert(false);
+                }
+                catch (const std::runtime_error&) {
+                }
+            }
+            else {
+                v.EmplaceBack(i);
+            }
+        }
+        assert(v.Size() == 100 && ParallelObj::alive == 90);
+        Vector<ParallelObj> frozen = v.Freeze();
+        assert(frozen.Size() == 90 && ParallelObj::alive == 90);
+        assert(frozen[0].id == 1 && frozen[89].id == 99);
+        ParallelObj::default_construction_throw_countdown = 0;
+    }
+    assert(ParallelObj::alive == 0);
+    {
+        // ,      ,  
+        struct FailingResource : std::pmr::memory_resource {
+            bool fail = false;
+
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                if (fail) {
+                    throw std::bad_alloc();
+                }
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+        FailingResource resource;
+        ConcurrentVector<int, std::pmr::polymorphic_allocator<int>> v(0, &resource);
+        const int FIRST = static_cast<int>(ConcurrentVector<int>::MIN_FIRST_SEGMENT);
+        for (int i = 0; i < FIRST; ++i) {
+            v.PushBack(i);
+        }
+        resource.fail = true;
+        try {
+            v.PushBack(FIRST);
+            assert(false);
+        }
+        catch (const std::bad_alloc&) {
+        }
+        resource.fail = false;
+        v.PushBack(FIRST + 1);
+        assert(v.Size() == static_cast<size_t>(FIRST + 2));
+        auto frozen = v.Freeze();
+        assert(frozen.Size() == static_cast<size_t>(FIRST + 1) && frozen.Back() == FIRST + 1);
+        assert(frozen.GetAllocator().resource() == &resource);
+    }
+}
+
+void Test23() {
+    static_assert(std::random_access_iterator<SegmentedVector<int>::iterator>);
+    static_assert(std::random_access_iterator<SegmentedVector<int>::const_iterator>);
+    const size_t SIZE = 10'000;
+    {
+        SegmentedVector<int> v;
+        v.PushBack(0);
+        const int* first = &v[0];
+        for (size_t i = 1; i < SIZE; ++i) {
+            v.PushBack(static_cast<int>(i));
+        }
+        //    
+        assert(&v[0] == first && v.Size() == SIZE && v.Capacity() >= SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            assert(v[i] == static_cast<int>(i));
+        }
+        assert(std::accumulate(v.begin(), v.end(), int64_t{ 0 }) == static_cast<int64_t>(SIZE * (SIZE - 1) / 2));
+
+        std::sort(v.begin(), v.end(), std::greater<int>{});
+        assert(v[0] == static_cast<int>(SIZE - 1) && v.Back() == 0 && v.end() - v.begin() == static_cast<ptrdiff_t>(SIZE));
+
+        v.Resize(100);
+        v.ShrinkToFit();
+        assert(v.Size() == 100 && v.Capacity() == 112 && &v[0] == first);
+        v.EmplaceBack(v[0]);
+        assert(v.Back() == static_cast<int>(SIZE - 1));
+    }
+    {
+        SegmentedVector<string, std::allocator<string>, 4> v;
+        for (int i = 0; i < 20; ++i) {
+            v.PushBack(to_string(i));
+        }
+        auto it = v.Insert(v.cbegin() + 5, v[19]);
+        assert(it - v.begin() == 5 && *it == "19"s && v.Size() == 21 && v[20] == "19"s && v[6] == "5"s);
+        it = v.Emplace(v.cbegin(), 3, 'a');
+        assert(*it == "aaa"s && v[1] == "0"s);
+        it = v.Erase(v.cbegin() + 1, v.cbegin() + 11);
+        assert(v.Size() == 12 && *it == "9"s);
+        it = v.Erase(v.cbegin());
+        assert(*it == "9"s && v.Size() == 11);
+
+        SegmentedVector<string, std::allocator<string>, 4> copy(v);
+        assert(std::equal(v.begin(), v.end(), copy.begin(), copy.end()));
+        SegmentedVector<string, std::allocator<string>, 4> small;
+        small.PushBack("x"s);
+        small = copy;
+        assert(small.Size() == v.Size() && small.Back() == v.Back());
+        copy.Resize(2);
+        small = copy;
+        assert(small.Size() == 2 && small[1] == v[1]);
+        SegmentedVector<string, std::allocator<string>, 4> moved(std::move(small));
+        assert(small.Size() == 0 && moved.Size() == 2);
+        moved.Clear();
+        assert(moved.Size() == 0 && moved.Capacity() != 0);
+    }
+    {
+        SegmentedVector<ParallelObj> v(10);
+        v.Reserve(100);
+        ParallelObj::default_construction_throw_countdown = 15;
+        try {
+            v.Resize(50);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 10 && ParallelObj::alive == 10);
+        ParallelObj::default_construction_throw_countdown = 0;
+
+        v[3].id = 3;
+        ParallelObj::throw_on_copy_id = 3;
+        try {
+            SegmentedVector<ParallelObj> copy(v);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(ParallelObj::alive == 10);
+        ParallelObj::throw_on_copy_id = -1;
+    }
+    assert(ParallelObj::alive == 0);
+    {
+        //  pmr    :       
+        using PmrSegmented = SegmentedVector<std::string, std::pmr::polymorphic_allocator<std::string>, 4>;
+        ArenaResource left_arena;
+        ArenaResource right_arena;
+        PmrSegmented left(&left_arena);
+        PmrSegmented right(&right_arena);
+        for (int i = 0; i < 50; ++i) {
+            right.PushBack(std::to_string(i));
+        }
+        left.PushBack("x"s);
+        left = right;
+        assert(left.GetAllocator().resource() == &left_arena && left.Size() == 50 && left[49] == "49"s);
+        left.Resize(3);
+        left = right;
+        assert(left.Size() == 50 && left[10] == "10"s);
+
+        PmrSegmented moved(&left_arena);
+        moved = std::move(right);
+        assert(moved.GetAllocator().resource() == &left_arena && moved.Size() == 50 && moved[25] == "25"s);
+
+        //        
+        PmrSegmented same(&left_arena);
+        const std::string* first = &moved[0];
+        same = std::move(moved);
+        assert(&same[0] == first && moved.Size() == 0);
+        left.Swap(same);
+        assert(&left[0] == first && same.Size() == 50);
+    }
+    {
+        //      ,    
+        using Alloc = PropagatingAllocator<std::string>;
+        using Propagating = SegmentedVector<std::string, Alloc, 4>;
+        int left_count = 0;
+        int right_count = 0;
+        {
+            Propagating left(Alloc{ &left_count });
+            Propagating right(Alloc{ &right_count });
+            for (int i = 0; i < 50; ++i) {
+                right.PushBack(std::to_string(i));
+                left.PushBack("x"s);
+            }
+            const int right_live = right_count;
+            left = right;
+            assert(left.GetAllocator() == Alloc{ &right_count } && left.Size() == 50 && left[49] == "49"s);
+            assert(left_count == 0 && right_count > right_live);
+
+            Propagating moved(Alloc{ &left_count });
+            moved.PushBack("y"s);
+            moved = std::move(right);
+            assert(moved.GetAllocator() == Alloc{ &right_count } && moved.Size() == 50 && moved[25] == "25"s);
+            assert(left_count == 0 && right.Size() == 0);
+        }
+        assert(left_count == 0 && right_count == 0);
+    }
+}
+
+void Test24() {
+    {
+        SoAVector<float, float, int, string> particles;
+        for (int i = 0; i < 1000; ++i) {
+            particles.EmplaceBack(static_cast<float>(i), 1.0f, i, to_string(i));
+        }
+        assert(particles.Size() == 1000 && particles.Capacity() >= 1000);
+        //     
+        std::span<const float> xs = std::as_const(particles).Column<0>();
+        assert(std::accumulate(xs.begin(), xs.end(), 0.0) == 999.0 * 1000 / 2);
+        for (auto [x, vx, id, name] : particles) {
+            x += vx;
+            name += "!";
+        }
+        const auto& [x0, vx0, id0, name0] = std::as_const(particles)[0];
+        assert(x0 == 1.0f && vx0 == 1.0f && id0 == 0 && name0 == "0!"s);
+
+        particles.Erase(0);
+        particles.Erase(particles.cbegin() + 10);
+        assert(particles.Size() == 998 && std::get<2>(particles[0]) == 1 && std::get<2>(particles[10]) == 12);
+        particles.Erase(100, 200);
+        assert(particles.Size() == 898 && std::get<3>(particles[100]) == "202!"s);
+
+        // ,      ,  
+        particles.ShrinkToFit();
+        assert(particles.Capacity() == particles.Size());
+        particles.EmplaceBack(std::get<0>(particles[0]), 2.0f, 7, std::get<3>(particles[0]));
+        assert(std::get<3>(particles[898]) == "1!"s && std::get<1>(particles[898]) == 2.0f);
+
+        SoAVector<float, float, int, string> copy(particles);
+        assert(copy.Size() == particles.Size() && std::get<3>(copy[500]) == std::get<3>(particles[500]));
+        particles.Resize(1000);
+        assert(std::get<3>(particles[999]).empty() && std::get<2>(particles[999]) == 0);
+        particles.PushBack({ 1.0f, 2.0f, 3, "row"s });
+        particles.PopBack();
+        copy = particles;
+        particles.Resize(10);
+        assert(particles.Size() == 10 && copy.Size() == 1000);
+        auto moved = std::move(copy);
+        assert(copy.Size() == 0 && moved.Size() == 1000);
+        moved.Clear();
+        assert(moved.Size() == 0);
+    }
+    {
+        //     :      
+        SoAVector<int, ParallelObj> v;
+        for (int i = 0; i < 10; ++i) {
+            v.EmplaceBack(i, i);
+        }
+        v.ShrinkToFit();
+        ParallelObj::throw_on_copy_id = 5;
+        try {
+            v.Reserve(100);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        ParallelObj::throw_on_copy_id = -1;
+        assert(v.Capacity() == 10 && v.Size() == 10 && ParallelObj::alive == 10);
+        assert(std::get<1>(v[5]).id == 5 && v.Column<0>()[9] == 9);
+
+        ParallelObj::default_construction_throw_countdown = 3;
+        try {
+            v.Resize(20);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        ParallelObj::default_construction_throw_countdown = 0;
+        assert(v.Size() == 10 && ParallelObj::alive == 10);
+    }
+    assert(ParallelObj::alive == 0);
+}
+
+template <typename T, typename Make, typename Value>
+void TestBatchErase(Make make, Value value) {
+    const int SIZE = 100;
+    Vector<T> v;
+    for (int i = 0; i < SIZE; ++i) {
+        v.PushBack(make(i));
+    }
+    assert(v.EraseIf([&value](const T& x) { return value(x) % 3 == 0; }) == 34);
+    assert(v.Size() == 66 && value(v[0]) == 1 && value(v[1]) == 2 && value(v[2]) == 4 && value(v.Back()) == 98);
+
+    //  :     ,    
+    bool thrown = false;
+    try {
+        v.EraseIf([&value](const T& x) {
+            if (value(x) == 50) {
+                throw std::runtime_error("Oops");
+            }
+            return value(x) % 2 == 0;
+        });
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && v.Size() == 66 - 16);
+    assert(value(v[0]) == 1 && value(v[1]) == 5 && value(v[17]) == 50 && value(v.Back()) == 98);
+
+    auto it = v.UnorderedErase(v.cbegin() + 1);
+    assert(value(*it) == 98 && v.Size() == 49);
+    it = v.UnorderedErase(v.cend() - 1);
+    assert(it == v.end() && v.Size() == 48);
+
+    const size_t indices[] = { 0, 1, 10, 47 };
+    const int expected_second = value(v[2]);
+    const int expected_last = value(v[46]);
+    v.EraseIndices(indices);
+    assert(v.Size() == 44 && value(v[0]) == expected_second && value(v.Back()) == expected_last);
+    v.EraseIndices(Vector<size_t>{});
+    assert(v.Size() == 44);
+}
+
+void Test25() {
+    TestBatchErase<int>([](int i) { return i; }, [](int x) { return x; });
+    TestBatchErase<string>([](int i) { return to_string(i); }, [](const string& s) { return std::stoi(s); });
+    TestBatchErase<std::unique_ptr<int>>([](int i) { return std::make_unique<int>(i); },
+        [](const std::unique_ptr<int>& p) { return *p; });
+    {
+        Vector<Obj> v(10);
+        const int alive_before = Obj::GetAliveObjectCount();
+        assert(v.EraseIf([](const Obj&) { return true; }) == 10);
+        assert(v.Size() == 0 && Obj::GetAliveObjectCount() == alive_before - 10);
+    }
+}
+
+struct Config {
+    int64_t id;
+    double weights[7];
+};
+
+void Test26() {
+    static_assert(std::is_trivially_copyable_v<Config>);
+    const size_t SIZE = 1000;
+    Vector<Config> source(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        source[i].id = static_cast<int64_t>(i);
+        source[i].weights[6] = i * 0.5;
+    }
+    const auto same = [&source](const auto& v) {
+        return v.Size() == SIZE && std::equal(source.begin(), source.end(), v.begin(), [](const Config& a, const Config& b) {
+            return a.id == b.id && a.weights[6] == b.weights[6];
+            });
+    };
+    {
+        Vector<Config> copy(source);
+        assert(same(copy));
+        Vector<Config> small(10);
+        small = source;
+        assert(same(small) && small.Capacity() == SIZE);
+        //       
+        Vector<Config> big(SIZE * 5);
+        const Config* data = &big[0];
+        big = source;
+        assert(same(big) && &big[0] == data && big.Capacity() == SIZE * 5);
+        big.Assign(source.begin(), source.begin() + 10);
+        assert(big.Size() == 10 && big[9].id == 9);
+        big.Assign(big.begin() + 2, big.end());
+        assert(big.Size() == 8 && big[0].id == 2 && big[7].id == 9);
+    }
+    {
+        //       ,    
+        ArenaResource arena(64 * 1024);
+        ArenaResource other(64 * 1024);
+        Vector<int, ArenaAllocator<int>> v(&arena);
+        v.PushBack(1);
+        const int* first = &v[0];
+        Vector<int, ArenaAllocator<int>> rhs(100, &other);
+        std::iota(rhs.begin(), rhs.end(), 0);
+        v = rhs;
+        assert(&v[0] == first && v.Size() == 100 && v[99] == 99);
+        assert(v.GetAllocator().Arena() == &arena);
+    }
+    {
+        Vector<string> strings(3);
+        Vector<string> rhs;
+        for (size_t i = 0; i < SIZE; ++i) {
+            rhs.PushBack(to_string(i));
+        }
+        strings = rhs;
+        assert(strings.Size() == SIZE && strings[SIZE - 1] == to_string(SIZE - 1));
+        strings.Assign(rhs);
+        assert(strings.Size() == SIZE && strings[10] == "10"s);
+    }
+}
+
+//  ,   
+constexpr StaticVector<uint32_t, 16> MakeSquares() {
+    StaticVector<uint32_t, 16> squares;
+    for (uint32_t i = 0; i < 12; ++i) {
+        squares.PushBack(i * i);
+    }
+    squares.EraseIf([](uint32_t x) {
+        return x % 2 != 0;
+    });
+    squares.Insert(squares.begin(), 1000u);
+    return squares;
+}
+
+constexpr size_t StaticStringsLength() {
+    StaticVector<std::string, 4> strings{ "abc"s, "de"s };
+    strings.Emplace(strings.begin() + 1, 3, 'x');
+    strings.Erase(strings.begin());
+    size_t length = 0;
+    for (const std::string& s : strings) {
+        length += s.size();
+    }
+    return length;
+}
+
+void Test27() {
+    static constexpr StaticVector<uint32_t, 16> SQUARES = MakeSquares();
+    static_assert(SQUARES.Size() == 7 && SQUARES[0] == 1000 && SQUARES[1] == 0 && SQUARES[6] == 100);
+    static_assert(StaticStringsLength() == 5);
+    static_assert(std::is_trivially_destructible_v<StaticVector<int, 8>>);
+    static_assert(!std::is_trivially_destructible_v<StaticVector<std::string, 8>>);
+    assert(SQUARES[3] == 16);
+
+    Obj::ResetCounters();
+    {
+        StaticVector<Obj, 4> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        v.Emplace(v.begin(), 0);
+        v.PushBack(Obj(3));
+        assert(v.IsFull() && v[0].id == 0 && v[1].id == 1 && v[3].id == 3);
+        //  -  ,   
+        try {
+            v.EmplaceBack(4);
+            assert(false);
+        } catch (const std::length_error&) {
+        }
+        try {
+            v.Emplace(v.begin(), 4);
+            assert(false);
+        } catch (const std::length_error&) {
+        }
+        assert(v.Size() == 4 && v[0].id == 0 && Obj::GetAliveObjectCount() == 4);
+        v.Erase(v.begin() + 1);
+        const std::vector<Obj> extra(2);
+        try {
+            v.Insert(v.begin(), extra.begin(), extra.end());
+            assert(false);
+        } catch (const std::length_error&) {
+        }
+        assert(v.Size() == 3 && v[1].id == 2 && Obj::GetAliveObjectCount() == 5);
+        StaticVector<Obj, 4> copy(v);
+        StaticVector<Obj, 4> other(2);
+        other.Swap(copy);
+        assert(other.Size() == 3 && copy.Size() == 2 && other[2].id == 3);
+        copy = v;
+        assert(copy.Size() == 3 && copy[0].id == 0);
+        v.UnorderedErase(v.begin());
+        assert(v.Size() == 2 && v[0].id == 3);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        //    Resize   
+        StaticVector<Obj, 8> v(2);
+        Obj::default_construction_throw_countdown = 3;
+        try {
+            v.Resize(6);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 2 && Obj::GetAliveObjectCount() == 2);
+        try {
+            v.Resize(9);
+            assert(false);
+        } catch (const std::length_error&) {
+        }
+        v.Resize(1);
+        assert(v.Size() == 1 && Obj::GetAliveObjectCount() == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        StaticVector<std::string, 3> v(2, "x"s);
+        std::istringstream input("a b c");
+        v.Assign(std::istream_iterator<std::string>(input), std::istream_iterator<std::string>());
+        assert(v.Size() == 3 && v[2] == "c"s);
+    }
+}
+
+void Test28() {
+    {
+        //      std::lower_bound   ,  
+        Vector<int> sorted;
+        for (int i = 0; i < 5000; ++i) {
+            sorted.PushBack(i / 3 * 2);
+        }
+        for (size_t size : { size_t{ 0 }, size_t{ 1 }, size_t{ 2 }, size_t{ 7 }, size_t{ 64 }, sorted.Size() }) {
+            for (int key = -1; key <= (size == 0 ? 0 : sorted[size - 1] + 1); ++key) {
+                const size_t expected = std::lower_bound(sorted.begin(), sorted.begin() + size, key) - sorted.begin();
+                assert(detail::BranchlessLowerBound(sorted.begin(), size, key, std::less<int>()) == expected);
+            }
+        }
+    }
+    {
+        FlatSet<int> set{ 5, 1, 3, 3, 9 };
+        assert(set.Size() == 4 && std::is_sorted(set.begin(), set.end()));
+        assert(!set.Insert(3).second && set.Insert(4).second && *set.Find(4) == 4);
+        const std::vector<int> more{ 2, 10, 2, 4, 0 };
+        set.InsertRange(more.begin(), more.end());
+        const std::vector<int> expected{ 0, 1, 2, 3, 4, 5, 9, 10 };
+        assert(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+        assert(set.Erase(5) == 1 && set.Erase(5) == 0 && !set.Contains(5) && set.Find(6) == set.end());
+    }
+    {
+        //      :  std::ranges   ,
+        //    -  
+        using Map = FlatMap<int, int>;
+        static_assert(std::random_access_iterator<Map::iterator>);
+        static_assert(std::is_same_v<std::iterator_traits<Map::iterator>::iterator_category, std::input_iterator_tag>);
+        static_assert(std::is_same_v<Map::const_iterator::iterator_category, std::input_iterator_tag>);
+        static_assert(std::is_same_v<Map::const_iterator::iterator_concept, std::random_access_iterator_tag>);
+        Map map{ { 2, 20 }, { 1, 10 } };
+        assert(std::ranges::lower_bound(map, 2, {}, [](const auto& item) { return item.first; })->second == 20);
+    }
+    {
+        FlatMap<std::string, int, std::less<>> map{ { "b"s, 2 }, { "a"s, 1 } };
+        //     std::string
+        const std::string_view key = "b"sv;
+        assert(map.Find(key)->second == 2 && map.Contains("a") && !map.Contains("c"sv));
+        map["c"] = 3;
+        ++map["a"];
+        assert(map.At("a") == 2 && map.Size() == 3);
+        try {
+            map.At("z");
+            assert(false);
+        } catch (const std::out_of_range&) {
+        }
+        assert(!map.InsertOrAssign("c"s, 30).second && map.At("c") == 30);
+        assert(!map.TryEmplace("b"s, 100).second && map.At("b") == 2);
+        //           ;   
+        const std::vector<std::pair<std::string, int>> batch{ { "d"s, 4 }, { "a"s, -1 }, { "0"s, 0 }, { "d"s, -4 } };
+        map.InsertRange(batch.begin(), batch.end());
+        const std::vector<std::string> keys{ "0"s, "a"s, "b"s, "c"s, "d"s };
+        assert(std::equal(map.Keys().begin(), map.Keys().end(), keys.begin(), keys.end()));
+        assert(map.At("a") == 2 && map.At("d") == 4 && map.Values()[0] == 0);
+        map.Erase(map.Find("b"sv));
+        assert(map.Erase("0"sv) == 1 && map.Size() == 3 && map.begin()->first == "a"s);
+    }
+    {
+        //        ,   std::map
+        FlatMap<uint32_t, uint32_t> flat;
+        std::map<uint32_t, uint32_t> tree;
+        Vector<std::pair<uint32_t, uint32_t>> batch;
+        for (uint32_t i = 0; i < 3000; ++i) {
+            const uint32_t key = (i * 2654435761u) % 1000;
+            batch.EmplaceBack(key, i);
+            tree.emplace(key, i);
+            if (i % 2 == 0) {
+                flat.Insert(std::pair{ key, i });
+            }
+            else {
+                flat.InsertRange(batch.end() - 1, batch.end());
+            }
+        }
+        assert(flat.Size() == tree.size() && std::equal(flat.begin(), flat.end(), tree.begin(), tree.end(),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.first == rhs.first && lhs.second == rhs.second;
+            }));
+        FlatMap<uint32_t, uint32_t> bulk;
+        bulk.InsertRange(batch.begin(), batch.end());
+        assert(std::equal(bulk.Values().begin(), bulk.Values().end(), flat.Values().begin(), flat.Values().end()));
+    }
+}
+
+//             
+template <typename U>
+void TestPackedUnpack(const PackedVector& packed) {
+    const SimdLevel detected = DetectSimdLevel();
+    for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512 }) {
+        if (level > detected) {
+            continue;
+        }
+        SetSimdLevel(level);
+        for (size_t first : { size_t{ 0 }, size_t{ 1 }, size_t{ 13 } }) {
+            for (size_t count : { size_t{ 0 }, size_t{ 3 }, size_t{ 8 }, size_t{ 61 }, packed.Size() - std::min(first, packed.Size()) }) {
+                if (first + count > packed.Size()) {
+                    continue;
+                }
+                Vector<U> output(count);
+                packed.Unpack(first, output);
+                for (size_t i = 0; i < count; ++i) {
+                    assert(output[i] == packed[first + i]);
+                }
+            }
+        }
+    }
+    SetSimdLevel(detected);
+}
+
+void Test29() {
+    static_assert(std::random_access_iterator<PackedVector::const_iterator>);
+    {
+        PackedVector packed;
+        std::vector<uint64_t> expected;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            const uint64_t value = i < 10 ? 0 : (i * 0x9e3779b97f4a7c15ull) >> (64 - std::min<uint64_t>(i / 10, 64));
+            packed.PushBack(value);
+            expected.push_back(value);
+        }
+        assert(packed.Bits() == 64 && packed.Size() == expected.size());
+        assert(std::equal(packed.begin(), packed.end(), expected.begin(), expected.end()));
+        packed.Set(1, 7);
+        packed.PopBack();
+        assert(packed[1] == 7 && packed.Back() == expected[998]);
+    }
+    {
+        // 33-   33      
+        PackedVector packed;
+        const size_t SIZE = 100000;
+        for (size_t i = 0; i < SIZE; ++i) {
+            packed.PushBack((uint64_t{ 1 } << 16) + i * 2654435761u % (uint64_t{ 1 } << 32));
+        }
+        assert(packed.Bits() == 33);
+        packed.ShrinkToFit();
+        assert(packed.MemoryUsage() == ((SIZE * 33 + 63) / 64 + 1) * sizeof(uint64_t) && packed.Capacity() >= SIZE);
+        TestPackedUnpack<uint64_t>(packed);
+        //      
+        packed.Resize(10);
+        for (size_t i = 0; i < packed.Size(); ++i) {
+            packed.Set(i, i);
+        }
+        packed.Set(3, 1u << 20);
+        packed.ShrinkToFit();
+        assert(packed.Bits() == 21 && packed[3] == 1u << 20 && packed[9] == 9);
+        TestPackedUnpack<uint32_t>(packed);
+    }
+    {
+        PackedVector zeros(100);
+        assert(zeros.Bits() == 0 && zeros[99] == 0);
+        zeros.Resize(200, 5);
+        assert(zeros.Bits() == 3 && zeros[99] == 0 && zeros[100] == 5 && zeros[199] == 5);
+        PackedVector wide;
+        wide.Reserve(300, 60);
+        for (uint64_t i = 0; i < 300; ++i) {
+            wide.PushBack(i << 50);
+        }
+        assert(wide.Bits() == 60 && wide.Capacity() >= 300);
+        TestPackedUnpack<uint64_t>(wide);
+        TestPackedUnpack<uint32_t>(zeros);
+    }
+}
+
+void Test30() {
+    static_assert(std::random_access_iterator<RingVector<int>::iterator>);
+    static_assert(std::is_same_v<std::iterator_traits<RingVector<int>::const_iterator>::iterator_category,
+        std::random_access_iterator_tag>);
+    static_assert(std::is_convertible_v<RingVector<int>::iterator, RingVector<int>::const_iterator>);
+    static_assert(!std::is_convertible_v<RingVector<int>::const_iterator, RingVector<int>::iterator>);
+    {
+        RingVector<int> ring;
+        // ,      ,  
+        for (int i = 0; i < 1000; ++i) {
+            ring.PushBack(i);
+            if (ring.Size() > 5) {
+                assert(ring.Front() == i - 5);
+                ring.PopFront();
+            }
+        }
+        assert(ring.Capacity() == RingVector<int>::MIN_CAPACITY && ring.Size() == 5 && ring.Back() == 999);
+        auto [first, second] = ring.Spans();
+        assert(first.size() + second.size() == 5 && first[0] == 995);
+        ring.PushFront(994);
+        ring.PushFront(993);
+        ring.PushBack(1000);
+        assert(ring.Size() == 8 && ring[0] == 993 && ring[7] == 1000);
+        //   :       
+        ring.PushFront(992);
+        assert(ring.Capacity() == 16 && ring.Size() == 9 && ring.Spans().first.size() == 1);
+        assert(std::is_sorted(ring.begin(), ring.end()) && ring[8] == 1000);
+        ring.PopBack();
+        ring.Reserve(20);
+        assert(ring.Capacity() == 32 && ring.Spans().second.empty() && ring.Back() == 999);
+    }
+    Obj::ResetCounters();
+    {
+        RingVector<Obj> ring;
+        for (int i = 0; i < 8; ++i) {
+            ring.EmplaceBack(i);
+        }
+        ring.PopFront();
+        ring.EmplaceBack(8);
+        //     EmplaceBack   
+        ring.PushBack(ring[2]);
+        assert(ring.Size() == 9 && ring.Back().id == 3 && ring[0].id == 1);
+        RingVector<Obj> copy(ring);
+        assert(copy.Size() == 9 && copy[8].id == 3 && Obj::GetAliveObjectCount() == 18);
+        ring = RingVector<Obj>();
+        copy.PopFront();
+        assert(Obj::GetAliveObjectCount() == 8);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        RingVector<std::string> ring;
+        for (int i = 0; i < 20; ++i) {
+            ring.PushFront(std::to_string(i));
+        }
+        assert(ring.Front() == "19"s && ring.Back() == "0"s);
+        const RingVector<std::string> copy = ring;
+        assert(std::equal(copy.begin(), copy.end(), ring.begin(), ring.end()));
+    }
+    {
+        //           
+        SpscRing<std::string> queue(64);
+        const int COUNT = 20000;
+        std::thread producer([&queue] {
+            for (int i = 0; i < COUNT; ++i) {
+                while (!queue.TryPush(std::to_string(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        int expected = 0;
+        std::string value;
+        while (expected < COUNT) {
+            if (expected % 2 == 0 && queue.TryPop(value)) {
+                assert(value == std::to_string(expected));
+                ++expected;
+            }
+            else if (queue.ConsumeAll([&expected](std::string& s) {
+                assert(s == std::to_string(expected));
+                ++expected;
+                }) == 0) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        assert(queue.SizeApprox() == 0 && queue.Capacity() == 64);
+        assert(queue.TryPush("left"s) && queue.TryEmplace(3, 'x'));
+    }
+    {
+        //     pmr    ,   
+        using PmrRing = RingVector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+        ArenaResource left_arena;
+        ArenaResource right_arena;
+        PmrRing left(&left_arena);
+        PmrRing right(&right_arena);
+        for (int i = 0; i < 20; ++i) {
+            right.PushFront(std::to_string(i));
+            right.PushBack(std::to_string(-i));
+            left.PushBack("x"s);
+        }
+        left = right;
+        assert(left.GetAllocator().resource() == &left_arena);
+        assert(left.Size() == right.Size() && left.Front() == "19"s && left.Back() == "-19"s);
+
+        PmrRing moved(&left_arena);
+        moved.PushBack("y"s);
+        moved = std::move(right);
+        assert(moved.GetAllocator().resource() == &left_arena && right.Size() == 0);
+        assert(moved.Size() == 40 && moved.Front() == "19"s && moved.Back() == "-19"s);
+        right.PushBack("z"s);
+        assert(right.Size() == 1 && right.Front() == "z"s);
+
+        //      
+        PmrRing same(&left_arena);
+        const std::string* first = &moved.Front();
+        same = std::move(moved);
+        assert(&same.Front() == first && moved.Size() == 0);
+    }
+    {
+        //           rhs
+        using Alloc = PropagatingAllocator<std::string>;
+        int left_count = 0;
+        int right_count = 0;
+        {
+            RingVector<std::string, Alloc> left(Alloc{ &left_count });
+            RingVector<std::string, Alloc> right(Alloc{ &right_count });
+            for (int i = 0; i < 10; ++i) {
+                right.PushFront(std::to_string(i));
+                left.PushBack("x"s);
+            }
+            left = right;
+            assert(left.GetAllocator() == Alloc{ &right_count });
+            assert(left.Size() == 10 && left.Front() == "9"s && left.Back() == "0"s);
+            assert(left_count == 0 && right_count == 2);
+
+            RingVector<std::string, Alloc> moved(Alloc{ &left_count });
+            moved.PushBack("y"s);
+            moved = std::move(right);
+            assert(moved.GetAllocator() == Alloc{ &right_count } && right.Size() == 0);
+            assert(moved.Size() == 10 && moved.Front() == "9"s);
+            assert(left_count == 0 && right_count == 2);
+        }
+        assert(left_count == 0 && right_count == 0);
+    }
+    {
+        //     :     
+        //        
+        RingVector<ThrowingMoveOnly> ring;
+        for (int i = 0; i < 8; ++i) {
+            ring.EmplaceBack(i);
+        }
+        for (int i = 0; i < 4; ++i) {
+            ring.PopFront();
+            ring.EmplaceBack(8 + i);
+        }
+        //   - 4    ,  - 4  
+        assert(ring.Spans().first.size() == 4 && ring.Spans().second.size() == 4);
+        ThrowingMoveOnly::throw_countdown = 6;
+        try {
+            ring.EmplaceBack(100);
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(ring.Size() == 8 && ring.Capacity() == 8 && *ring.Back().value == 11);
+        ThrowingMoveOnly::throw_countdown = 0;
+    }
+}
+
+void Test31() {
+    {
+        Vector<std::string> table;
+        for (int i = 0; i < 100; ++i) {
+            table.PushBack(std::to_string(i));
+        }
+        SharedVector<std::string> shared(std::move(table));
+        //    
+        SharedVector<std::string> snapshot = shared;
+        assert(snapshot.IsShared() && &snapshot[0] == &shared[0] && snapshot.Size() == 100);
+        //   ,   
+        shared.PushBack("100"s);
+        assert(!shared.IsShared() && !snapshot.IsShared() && &snapshot[0] != &shared[0]);
+        assert(shared.Size() == 101 && snapshot.Size() == 100 && snapshot[99] == "99"s);
+        //      
+        const std::string* data = &shared[0];
+        shared.Mutate()[0] = "zero"s;
+        assert(&shared[0] == data && shared[0] == "zero"s && snapshot[0] == "0"s);
+        SharedVector<std::string> empty;
+        assert(empty.Size() == 0 && empty.begin() == empty.end() && empty.View().Size() == 0);
+        empty.EmplaceBack(3, 'x');
+        assert(empty[0] == "xxx"s);
+    }
+    {
+        //     :      
+        const size_t SIZE = 1000;
+        const int VERSIONS = 200;
+        PublishedVector<int> published{ SharedVector<int>(Vector<int>(SIZE)) };
+        std::atomic<bool> done{ false };
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 3; ++r) {
+            readers.emplace_back([&published, &done] {
+                int last = 0;
+                while (!done.load()) {
+                    const SharedVector<int> snapshot = published.Snapshot();
+                    const int version = snapshot[0];
+                    assert(version >= last);
+                    assert(std::all_of(snapshot.begin(), snapshot.end(), [version](int x) {
+                        return x == version;
+                        }));
+                    last = version;
+                }
+            });
+        }
+        for (int version = 1; version <= VERSIONS; ++version) {
+            if (version % 2 == 0) {
+                Vector<int> next(SIZE);
+                std::fill(next.begin(), next.end(), version);
+                published.Publish(SharedVector<int>(std::move(next)));
+            }
+            else {
+                published.Modify([](Vector<int>& v) {
+                    for (int& x : v) {
+                        ++x;
+                    }
+                });
+            }
+        }
+        done.store(true);
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        assert(published.Snapshot()[SIZE - 1] == VERSIONS);
+    }
+}
+
+void Test32() {
+    {
+        //    ,   ,  ForEachChunk
+        //        
+        const parallel_t policy{ 4, 1024, true };
+        const size_t SIZE = 100'000;
+        Vector<int, NumaAllocator<int>> v(policy, SIZE);
+        assert(v.Size() == SIZE && std::all_of(v.begin(), v.end(), [](int x) {
+            return x == 0;
+            }));
+        assert(reinterpret_cast<std::uintptr_t>(v.begin()) % NumaAllocator<int>::PAGE_SIZE == 0);
+        std::mutex chunks_mutex;
+        std::vector<std::pair<const int*, const int*>> chunks;
+        v.ForEachChunk(policy, [&](int* first, int* last) {
+            std::iota(first, last, static_cast<int>(first - v.begin()));
+            std::lock_guard lock(chunks_mutex);
+            chunks.emplace_back(first, last);
+            });
+        std::sort(chunks.begin(), chunks.end());
+        assert(chunks.size() == 4 && chunks.front().first == v.begin() && chunks.back().second == v.end());
+        for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+            assert(chunks[i].second == chunks[i + 1].first);
+            assert((chunks[i].second - v.begin()) * sizeof(int) % NumaAllocator<int>::PAGE_SIZE == 0);
+        }
+        const Vector<int, NumaAllocator<int>>& cv = v;
+        std::atomic<size_t> mismatches{ 0 };
+        cv.ForEachChunk(policy, [&](const int* first, const int* last) {
+            for (const int* it = first; it != last; ++it) {
+                mismatches += *it != static_cast<int>(it - cv.begin());
+            }
+            });
+        assert(mismatches == 0);
+    }
+    {
+        //    0,   ,  ;   mremap  
+        Vector<int64_t, NumaAllocator<int64_t>> bound(NumaAllocator<int64_t>::OnNode(0));
+        for (int64_t i = 0; i < 200'000; ++i) {
+            bound.PushBack(i);
+        }
+        assert(bound[0] == 0 && bound[199'999] == 199'999);
+        Vector<int64_t, NumaAllocator<int64_t>> interleaved(parallel, 50'000, NumaAllocator<int64_t>::Interleaved(1));
+        assert(interleaved.GetAllocator().Policy() == NumaPolicy::Interleave);
+        //     
+        Vector<char, NumaAllocator<char>> missing(1 << 20, NumaAllocator<char>::OnNode(63));
+        assert(missing[(1 << 20) - 1] == 0);
+        //    
+        interleaved = bound;
+        assert(interleaved.GetAllocator() == bound.GetAllocator() && interleaved[199'999] == 199'999);
+        assert(NumaAllocator<int>() != NumaAllocator<int>::OnNode(0));
+        //     
+        Vector<int, NumaAllocator<int>> small(10, NumaAllocator<int>::OnNode(0));
+        assert(reinterpret_cast<std::uintptr_t>(small.begin()) % CACHE_LINE_SIZE == 0);
+    }
+}
+
+struct ParseLoopTag {
+    static constexpr std::string_view NAME = "parse loop";
+};
+
+struct PreloadedTag {
+    static constexpr std::string_view NAME = "preloaded";
+};
+
+struct SteadyTag {
+    static constexpr std::string_view NAME = "steady";
+};
+
+void Test33() {
+    {
+        using Hinted = AdaptiveVector<int, ParseLoopTag>;
+        {
+            //        
+            Hinted v;
+            for (int i = 0; i < 1000; ++i) {
+                v.PushBack(i);
+            }
+            assert(v.Capacity() == 1024);
+            //       
+            Hinted moved(std::move(v));
+            Hinted empty;
+        }
+        {
+            //          
+            Hinted v;
+            v.PushBack(0);
+            assert(v.Capacity() == 1000);
+            for (int i = 1; i < 2000; ++i) {
+                v.PushBack(i);
+            }
+        }
+        size_t hint = 0;
+        CapacityHints::ForEach([&hint](std::string_view name, size_t value) {
+            if (name == "parse loop"sv) {
+                hint = value;
+            }
+            });
+        assert(hint == 1000 - 1000 / 4 + 2000 / 4);
+        // Reserve  Resize   
+        Hinted reserved;
+        reserved.Reserve(10);
+        reserved.PushBack(1);
+        assert(reserved.Capacity() == 10);
+        std::ostringstream saved;
+        CapacityHints::Save(saved);
+        assert(saved.str().find("1250 parse loop\n"s) != std::string::npos);
+    }
+    {
+        // ,     ,   
+        std::istringstream hints("300 preloaded\n77 parse loop\n"s);
+        CapacityHints::Load(hints);
+        AdaptiveVector<std::string, PreloadedTag, std::allocator<std::string>, AutoShrink<>> v;
+        v.EmplaceBack("x"s);
+        assert(v.Capacity() == 300);
+        AdaptiveVector<int, ParseLoopTag> loaded;
+        loaded.PushBack(1);
+        assert(loaded.Capacity() == 77);
+        //      
+        v.Resize(300);
+        v.Resize(10);
+        assert(v.Capacity() == 20);
+    }
+    {
+        // ,    ,       
+        using Steady = AdaptiveVector<int, SteadyTag>;
+        const auto record = [](int size, int times) {
+            for (int i = 0; i < times; ++i) {
+                Steady v;
+                for (int j = 0; j < size; ++j) {
+                    v.PushBack(j);
+                }
+            }
+        };
+        const auto predicted = [] {
+            size_t hint = 0;
+            CapacityHints::ForEach([&hint](std::string_view name, size_t value) {
+                if (name == "steady"sv) {
+                    hint = value;
+                }
+                });
+            return hint;
+        };
+        record(4, 1);
+        record(7, 10);
+        assert(predicted() == 7);
+        record(2, 10);
+        assert(predicted() == 2);
+        record(3, 10);
+        assert(predicted() == 3);
+    }
+}
+
+void Test34() {
+    ThreadPool pool(4);
+    std::mt19937_64 random(34);
+    {
+        //     ;     
+        std::atomic<int> calls{ 0 };
+        pool.ForEach(8, [&](size_t) {
+            pool.ForEach(8, [&](size_t) {
+                ++calls;
+                });
+            });
+        assert(calls == 64);
+        try {
+            pool.ForEach(16, [&](size_t i) {
+                ++calls;
+                if (i % 5 == 0) {
+                    throw std::runtime_error("task"s);
+                }
+                });
+            assert(false);
+        }
+        catch (const std::runtime_error&) {
+            assert(calls == 80);
+        }
+    }
+    {
+        //         
+        Vector<int64_t> ints(300'000);
+        for (int64_t& x : ints) {
+            x = static_cast<int64_t>(random()) >> (random() % 64);
+        }
+        std::vector<int64_t> expected(ints.begin(), ints.end());
+        std::sort(expected.begin(), expected.end());
+        ParallelSort(pool, ints);
+        assert(std::equal(ints.begin(), ints.end(), expected.begin(), expected.end()));
+        Vector<double> doubles(100'000);
+        for (double& x : doubles) {
+            x = std::ldexp(static_cast<double>(random() % 2001) - 1000.0, static_cast<int>(random() % 80) - 40);
+        }
+        doubles[0] = -std::numeric_limits<double>::infinity();
+        doubles[1] = std::numeric_limits<double>::max();
+        ParallelSort(pool, doubles, std::less<double>());
+        assert(std::is_sorted(doubles.begin(), doubles.end()) && doubles[0] == -std::numeric_limits<double>::infinity());
+        //    ,    
+        Vector<uint16_t> narrow(50'000);
+        for (uint16_t& x : narrow) {
+            x = static_cast<uint16_t>(random() % 200);
+        }
+        ParallelSort(pool, narrow);
+        assert(std::is_sorted(narrow.begin(), narrow.end()));
+    }
+    {
+        //       ;   
+        for (int round = 0; round < 2; ++round) {
+            Vector<std::string> words(120'000);
+            for (std::string& word : words) {
+                word = std::to_string(random() % 100'000);
+            }
+            std::vector<std::string> expected(words.begin(), words.end());
+            std::sort(expected.begin(), expected.end(), std::greater<>());
+            ParallelSort(pool, words, std::greater<>());
+            assert(std::equal(words.begin(), words.end(), expected.begin(), expected.end()));
+        }
+        ReleaseAlgorithmScratch<std::string>();
+        //    ,      
+        std::vector<Vector<int>> many(4);
+        for (Vector<int>& v : many) {
+            v.Resize(40'000);
+            for (int& x : v) {
+                x = static_cast<int>(random() % 1000);
+            }
+        }
+        pool.ForEach(many.size(), [&](size_t i) {
+            ParallelSort(pool, many[i], [](int a, int b) {
+                return a > b;
+                });
+            });
+        for (const Vector<int>& v : many) {
+            assert(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+        }
+    }
+    {
+        //  k-    
+        std::vector<Vector<std::pair<int, int>>> runs(5);
+        for (int input = 0; input < 5; ++input) {
+            for (int i = 0; i < 20'000 * input; ++i) {
+                runs[input].EmplaceBack(static_cast<int>(random() % 5000), input);
+            }
+            std::sort(runs[input].begin(), runs[input].end());
+        }
+        const auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            return a.first < b.first;
+        };
+        Vector<std::pair<int, int>> merged;
+        merged.Reserve(200'000);
+        const auto* buffer = merged.begin();
+        ParallelMerge(pool, runs, merged, by_key);
+        assert(merged.Size() == 200'000 && merged.begin() == buffer);
+        assert(std::is_sorted(merged.begin(), merged.end()));
+        std::vector<Vector<std::string>> texts(3);
+        for (int i = 0; i < 30'000; ++i) {
+            texts[i % 3].PushBack(std::to_string(100'000 + i));
+        }
+        Vector<std::string> all;
+        ParallelMerge(pool, texts, all);
+        assert(all.Size() == 30'000 && std::is_sorted(all.begin(), all.end()) && all[0] == "100000"s);
+        //         
+        struct Key {
+            explicit Key(int v) : value(v) {
+            }
+            int value;
+        };
+        std::vector<Vector<Key>> keys(2);
+        for (int i = 0; i < 40'000; ++i) {
+            keys[i % 2].EmplaceBack(i);
+        }
+        Vector<Key> joined;
+        ParallelMerge(pool, keys, joined, [](const Key& a, const Key& b) {
+            return a.value < b.value;
+            });
+        assert(joined.Size() == 40'000 && joined[0].value == 0 && joined[39'999].value == 39'999);
+        for (size_t i = 0; i < joined.Size(); ++i) {
+            assert(joined[i].value == static_cast<int>(i));
+        }
+    }
+    {
+        //  
+        Vector<uint64_t> values(100'001);
+        std::iota(values.begin(), values.end(), uint64_t{ 1 });
+        Vector<uint64_t> inclusive(values);
+        ParallelInclusiveScan(pool, inclusive);
+        assert(inclusive[0] == 1 && inclusive[100'000] == uint64_t{ 100'001 } * 100'002 / 2);
+        for (size_t i = 1; i < inclusive.Size(); ++i) {
+            assert(inclusive[i] == inclusive[i - 1] + values[i]);
+        }
+        Vector<uint64_t> exclusive(values);
+        ParallelExclusiveScan(pool, exclusive, uint64_t{ 10 });
+        assert(exclusive[0] == 10);
+        for (size_t i = 0; i < exclusive.Size(); ++i) {
+            assert(exclusive[i] + values[i] == inclusive[i] + 10);
+        }
+        //  :    x * a + b
+        using Affine = std::pair<uint64_t, uint64_t>;
+        const auto compose = [](const Affine& f, const Affine& g) {
+            return Affine{ f.first * g.first, f.second * g.first + g.second };
+        };
+        Vector<Affine> functions(70'000);
+        for (Affine& f : functions) {
+            f = { random() | 1, random() };
+        }
+        std::vector<Affine> expected(functions.begin(), functions.end());
+        std::inclusive_scan(expected.begin(), expected.end(), expected.begin(), compose);
+        ParallelInclusiveScan(pool, functions, compose);
+        assert(std::equal(functions.begin(), functions.end(), expected.begin(), expected.end()));
+    }
+}
 
 int main() {
     try {
@@ -887,9 +3271,36 @@ int main() {
         Test4();
         Test5();
         Test6();
-        Benchmark();
+        Test7();
         TestEmplaceAdditional_move_noexcept_copy();
         TestEmplaceAdditional_move_without_noexcept_copy();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
+        Test32();
+        Test33();
+        Test34();
         std::cerr << "Tests passed"s << endl;
     }
     catch (const std::exception& e) {
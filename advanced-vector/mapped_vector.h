@@ -0,0 +1,388 @@
+#pragma once
+#include "vector.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//    ,       .
+//       , ,     ,
+//   - .       ,   
+//   .       ( Linux -  mremap).
+// ,    ,   ,       .
+//  POSIX (open, mmap, ftruncate)
+template <typename T, typename GrowthPolicy = DoublingGrowth>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector stores elements as raw bytes");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr uint64_t MAGIC = 0x524f544345564d4dull; // "MMVECTOR"
+    static constexpr uint32_t VERSION = 1;
+
+    enum class Mode
+    {
+        ReadOnly,
+        ReadWrite,
+    };
+
+    MappedVector() = default;
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1))
+        , mapping_(std::exchange(other.mapping_, nullptr))
+        , mapping_size_(std::exchange(other.mapping_size_, 0))
+        , read_only_(other.read_only_)
+    {
+    }
+
+    MappedVector& operator=(MappedVector&& rhs) noexcept
+    {
+        MappedVector moved(std::move(rhs));
+        Swap(moved);
+        return *this;
+    }
+
+    ~MappedVector()
+    {
+        Close();
+    }
+
+    //   path (  )    capacity 
+    static MappedVector Create(const std::string& path, size_t capacity = 0)
+    {
+        MappedVector result;
+        result.fd_ = OpenFile(path, O_RDWR | O_CREAT | O_TRUNC);
+        const size_t file_size = FileSize(capacity);
+        if (ftruncate(result.fd_, static_cast<off_t>(file_size)) != 0)
+        {
+            ThrowSystemError("ftruncate");
+        }
+        result.Map(file_size);
+        Header& header = result.GetHeader();
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.element_size = sizeof(T);
+        header.element_alignment = alignof(T);
+        header.size = 0;
+        header.capacity = capacity;
+        return result;
+    }
+
+    //  ,  Create.  std::runtime_error,   
+    //       
+    static MappedVector Open(const std::string& path, Mode mode = Mode::ReadWrite)
+    {
+        MappedVector result;
+        result.read_only_ = mode == Mode::ReadOnly;
+        result.fd_ = OpenFile(path, result.read_only_ ? O_RDONLY : O_RDWR);
+        struct stat info{};
+        if (fstat(result.fd_, &info) != 0)
+        {
+            ThrowSystemError("fstat");
+        }
+        const auto file_size = static_cast<size_t>(info.st_size);
+        if (file_size < DATA_OFFSET)
+        {
+            throw std::runtime_error("MappedVector: file is too small: " + path);
+        }
+        result.Map(file_size);
+        const Header& header = result.GetHeader();
+        if (header.magic != MAGIC || header.version != VERSION || header.element_size != sizeof(T)
+            || header.element_alignment != alignof(T) || header.size > header.capacity
+            || header.capacity > (file_size - DATA_OFFSET) / sizeof(T))
+        {
+            throw std::runtime_error("MappedVector: incompatible file: " + path);
+        }
+        return result;
+    }
+
+    //       .   
+    void Close() noexcept
+    {
+        if (mapping_ != nullptr)
+        {
+            munmap(mapping_, mapping_size_);
+            mapping_ = nullptr;
+            mapping_size_ = 0;
+        }
+        if (fd_ >= 0)
+        {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    //      
+    void Flush()
+    {
+        if (mapping_ != nullptr && !read_only_ && msync(mapping_, mapping_size_, MS_SYNC) != 0)
+        {
+            ThrowSystemError("msync");
+        }
+    }
+
+    bool IsOpen() const noexcept
+    {
+        return mapping_ != nullptr;
+    }
+
+    bool IsReadOnly() const noexcept
+    {
+        return read_only_;
+    }
+
+    size_t Size() const noexcept
+    {
+        return IsOpen() ? GetHeader().size : 0;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return IsOpen() ? GetHeader().capacity : 0;
+    }
+
+    //    ,    ,      
+    iterator begin() noexcept
+    {
+        return Data();
+    }
+    iterator end() noexcept
+    {
+        return begin() + Size();
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_cast<MappedVector&>(*this).Data();
+    }
+    const_iterator cend() const noexcept
+    {
+        return cbegin() + Size();
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(index < Size());
+        return cbegin()[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < Size());
+        return begin()[index];
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        assert(IsOpen() && !read_only_);
+        if (new_capacity <= Capacity())
+        {
+            return;
+        }
+        const size_t file_size = FileSize(new_capacity);
+        if (ftruncate(fd_, static_cast<off_t>(file_size)) != 0)
+        {
+            ThrowSystemError("ftruncate");
+        }
+        Remap(file_size);
+        GetHeader().capacity = new_capacity;
+    }
+
+    //    
+    void Resize(size_t new_size)
+    {
+        assert(IsOpen() && !read_only_);
+        const size_t size = Size();
+        if (new_size > size)
+        {
+            Reserve(new_size);
+            //     ,    PopBack    
+            std::memset(static_cast<void*>(Data() + size), 0, (new_size - size) * sizeof(T));
+        }
+        GetHeader().size = new_size;
+    }
+
+    void PushBack(const T& value)
+    {
+        EmplaceBack(value);
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        assert(IsOpen() && !read_only_);
+        //     ,     
+        T value(std::forward<Args>(args)...);
+        const size_t size = Size();
+        if (size == Capacity())
+        {
+            Reserve(std::max(GrowthPolicy::template NextCapacity<T>(size, size + 1), size + 1));
+        }
+        T* slot = Data() + size;
+        std::memcpy(static_cast<void*>(slot), &value, sizeof(T));
+        GetHeader().size = size + 1;
+        return *slot;
+    }
+
+    void PopBack() noexcept
+    {
+        assert(Size() != 0 && !read_only_);
+        --GetHeader().size;
+    }
+
+    void Clear() noexcept
+    {
+        assert(!read_only_);
+        if (IsOpen())
+        {
+            GetHeader().size = 0;
+        }
+    }
+
+    //    
+    void ShrinkToFit()
+    {
+        assert(IsOpen() && !read_only_);
+        const size_t size = Size();
+        if (size == Capacity())
+        {
+            return;
+        }
+        const size_t file_size = FileSize(size);
+        GetHeader().capacity = size;
+        Remap(file_size);
+        if (ftruncate(fd_, static_cast<off_t>(file_size)) != 0)
+        {
+            ThrowSystemError("ftruncate");
+        }
+    }
+
+    void Swap(MappedVector& other) noexcept
+    {
+        std::swap(fd_, other.fd_);
+        std::swap(mapping_, other.mapping_);
+        std::swap(mapping_size_, other.mapping_size_);
+        std::swap(read_only_, other.read_only_);
+    }
+
+private:
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t element_size;
+        uint64_t element_alignment;
+        uint64_t size;
+        uint64_t capacity;
+    };
+
+    //     - ( alignof(T),   );
+    //     
+    static constexpr size_t DATA_ALIGNMENT = std::max<size_t>(64, alignof(T));
+    static constexpr size_t DATA_OFFSET = (sizeof(Header) + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+
+    static size_t FileSize(size_t capacity)
+    {
+        if (capacity > (static_cast<size_t>(-1) - DATA_OFFSET) / sizeof(T))
+        {
+            throw std::length_error("MappedVector: capacity is too large");
+        }
+        return DATA_OFFSET + capacity * sizeof(T);
+    }
+
+    [[noreturn]] static void ThrowSystemError(const char* operation)
+    {
+        throw std::system_error(errno, std::generic_category(), operation);
+    }
+
+    static int OpenFile(const std::string& path, int flags)
+    {
+        const int fd = open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+        return fd;
+    }
+
+    void Map(size_t size)
+    {
+        const int protection = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* mapping = mmap(nullptr, size, protection, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ThrowSystemError("mmap");
+        }
+        mapping_ = mapping;
+        mapping_size_ = size;
+    }
+
+    void Remap(size_t new_size)
+    {
+#if defined(__linux__)
+        void* mapping = mremap(mapping_, mapping_size_, new_size, MREMAP_MAYMOVE);
+        if (mapping == MAP_FAILED)
+        {
+            ThrowSystemError("mremap");
+        }
+        mapping_ = mapping;
+        mapping_size_ = new_size;
+#else
+        void* mapping = mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ThrowSystemError("mmap");
+        }
+        munmap(mapping_, mapping_size_);
+        mapping_ = mapping;
+        mapping_size_ = new_size;
+#endif
+    }
+
+    Header& GetHeader() noexcept
+    {
+        assert(IsOpen());
+        return *static_cast<Header*>(mapping_);
+    }
+
+    const Header& GetHeader() const noexcept
+    {
+        return const_cast<MappedVector&>(*this).GetHeader();
+    }
+
+    T* Data() noexcept
+    {
+        return IsOpen() ? reinterpret_cast<T*>(static_cast<std::byte*>(mapping_) + DATA_OFFSET) : nullptr;
+    }
+
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    bool read_only_ = false;
+};
@@ -0,0 +1,335 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+//  :       ,
+//    ( ) ,       Release()
+class ArenaResource : public std::pmr::memory_resource
+{
+public:
+    explicit ArenaResource(size_t initial_block_size = 4096,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_(upstream)
+        , next_block_size_(std::max(initial_block_size, sizeof(BlockHeader) * 2))
+    {
+    }
+
+    //       (,  ),    
+    ArenaResource(void* buffer, size_t size,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_(upstream)
+        , initial_buffer_(static_cast<std::byte*>(buffer))
+        , initial_size_(size)
+        , current_(initial_buffer_)
+        , end_(initial_buffer_ + size)
+        , next_block_size_(std::max(size, sizeof(BlockHeader) * 2))
+    {
+    }
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+
+    ~ArenaResource() override
+    {
+        Release();
+    }
+
+    //      . ,  ,  
+    void Release() noexcept
+    {
+        while (blocks_ != nullptr)
+        {
+            BlockHeader* next = blocks_->next;
+            upstream_->deallocate(blocks_, blocks_->size, alignof(std::max_align_t));
+            blocks_ = next;
+        }
+        current_ = initial_buffer_;
+        end_ = initial_buffer_ + initial_size_;
+        last_allocation_ = nullptr;
+        bytes_allocated_ = 0;
+    }
+
+    //  ,       Release()
+    size_t BytesAllocated() const noexcept
+    {
+        return bytes_allocated_;
+    }
+
+    std::pmr::memory_resource* Upstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    //       p  old_bytes  new_bytes,     
+    bool TryExpand(void* p, size_t old_bytes, size_t new_bytes) noexcept
+    {
+        auto* begin = static_cast<std::byte*>(p);
+        if (begin != last_allocation_ || begin + old_bytes != current_ || begin + new_bytes > end_)
+        {
+            return false;
+        }
+        current_ = begin + new_bytes;
+        bytes_allocated_ += new_bytes - old_bytes;
+        return true;
+    }
+
+private:
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        BlockHeader* next;
+        size_t size;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        std::byte* result = AlignUp(current_, alignment);
+        if (current_ == nullptr || result + bytes > end_)
+        {
+            AllocateBlock(bytes + alignment);
+            result = AlignUp(current_, alignment);
+        }
+        current_ = result + bytes;
+        last_allocation_ = result;
+        bytes_allocated_ += bytes;
+        return result;
+    }
+
+    //     :    
+    //  ,    
+    void do_deallocate(void* p, size_t bytes, size_t /*alignment*/) noexcept override
+    {
+        if (p == last_allocation_ && static_cast<std::byte*>(p) + bytes == current_)
+        {
+            current_ = last_allocation_;
+            last_allocation_ = nullptr;
+            bytes_allocated_ -= bytes;
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    void AllocateBlock(size_t min_bytes)
+    {
+        const size_t block_size = std::max(next_block_size_, min_bytes + sizeof(BlockHeader));
+        void* memory = upstream_->allocate(block_size, alignof(std::max_align_t));
+        blocks_ = new (memory) BlockHeader{ blocks_, block_size };
+        current_ = reinterpret_cast<std::byte*>(blocks_ + 1);
+        end_ = static_cast<std::byte*>(memory) + block_size;
+        next_block_size_ = block_size * 2;
+    }
+
+    static std::byte* AlignUp(std::byte* p, size_t alignment) noexcept
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(p);
+        return p + ((alignment - address % alignment) % alignment);
+    }
+
+    std::pmr::memory_resource* upstream_;
+    std::byte* initial_buffer_ = nullptr;
+    size_t initial_size_ = 0;
+    std::byte* current_ = nullptr;
+    std::byte* end_ = nullptr;
+    std::byte* last_allocation_ = nullptr;
+    BlockHeader* blocks_ = nullptr;
+    size_t next_block_size_;
+    size_t bytes_allocated_ = 0;
+};
+
+//   ArenaResource.    std::pmr::polymorphic_allocator 
+//  expand,  Vector,    ,     
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaAllocator(ArenaResource* arena) noexcept
+        : arena_(arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : arena_(other.Arena())
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        if (n > static_cast<size_t>(-1) / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        arena_->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    bool expand(T* p, size_t old_n, size_t new_n) noexcept
+    {
+        return new_n <= static_cast<size_t>(-1) / sizeof(T)
+            && arena_->TryExpand(p, old_n * sizeof(T), new_n * sizeof(T));
+    }
+
+    ArenaResource* Arena() const noexcept
+    {
+        return arena_;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept
+    {
+        return arena_ == other.Arena();
+    }
+
+private:
+    ArenaResource* arena_;
+};
+
+//       -   8   MAX_POOLED_SIZE.
+//        
+class PoolResource : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t MIN_CLASS_SIZE = 8;
+    static constexpr size_t MAX_POOLED_SIZE = 64 * 1024;
+
+    explicit PoolResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+        size_t chunk_size = 64 * 1024) noexcept
+        : upstream_(upstream)
+        , chunk_size_(std::max(chunk_size, MAX_POOLED_SIZE + sizeof(ChunkHeader)))
+    {
+    }
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    ~PoolResource() override
+    {
+        Release();
+    }
+
+    //      ,      
+    void Release() noexcept
+    {
+        while (chunks_ != nullptr)
+        {
+            ChunkHeader* next = chunks_->next;
+            upstream_->deallocate(chunks_, chunk_size_, alignof(std::max_align_t));
+            chunks_ = next;
+        }
+        free_lists_.fill(nullptr);
+        current_ = end_ = nullptr;
+    }
+
+    std::pmr::memory_resource* Upstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    //  ,       bytes 
+    static size_t ClassSize(size_t bytes) noexcept
+    {
+        return std::bit_ceil(std::max(bytes, MIN_CLASS_SIZE));
+    }
+
+private:
+    static constexpr size_t CLASS_COUNT = std::countr_zero(MAX_POOLED_SIZE) - std::countr_zero(MIN_CLASS_SIZE) + 1;
+
+    struct alignas(std::max_align_t) ChunkHeader
+    {
+        ChunkHeader* next;
+    };
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static bool IsPooled(size_t bytes, size_t alignment) noexcept
+    {
+        return alignment <= alignof(std::max_align_t) && std::max(bytes, alignment) <= MAX_POOLED_SIZE;
+    }
+
+    static size_t ClassIndex(size_t class_size) noexcept
+    {
+        return std::countr_zero(class_size) - std::countr_zero(MIN_CLASS_SIZE);
+    }
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        if (!IsPooled(bytes, alignment))
+        {
+            return upstream_->allocate(bytes, alignment);
+        }
+        const size_t class_size = ClassSize(std::max(bytes, alignment));
+        FreeBlock*& head = free_lists_[ClassIndex(class_size)];
+        if (head != nullptr)
+        {
+            return std::exchange(head, head->next);
+        }
+        return Carve(class_size);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) noexcept override
+    {
+        if (!IsPooled(bytes, alignment))
+        {
+            upstream_->deallocate(p, bytes, alignment);
+            return;
+        }
+        FreeBlock*& head = free_lists_[ClassIndex(ClassSize(std::max(bytes, alignment)))];
+        head = new (p) FreeBlock{ head };
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    //     ,    min(class_size, alignof(std::max_align_t))
+    void* Carve(size_t class_size)
+    {
+        const size_t alignment = std::min(class_size, alignof(std::max_align_t));
+        std::byte* result = current_;
+        if (result != nullptr)
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(result);
+            result += (alignment - address % alignment) % alignment;
+        }
+        if (result == nullptr || result + class_size > end_)
+        {
+            void* memory = upstream_->allocate(chunk_size_, alignof(std::max_align_t));
+            chunks_ = new (memory) ChunkHeader{ chunks_ };
+            end_ = static_cast<std::byte*>(memory) + chunk_size_;
+            result = ChunkBegin();
+        }
+        current_ = result + class_size;
+        return result;
+    }
+
+    std::byte* ChunkBegin() const noexcept
+    {
+        return reinterpret_cast<std::byte*>(chunks_ + 1);
+    }
+
+    std::pmr::memory_resource* upstream_;
+    size_t chunk_size_;
+    ChunkHeader* chunks_ = nullptr;
+    std::byte* current_ = nullptr;
+    std::byte* end_ = nullptr;
+    std::array<FreeBlock*, CLASS_COUNT> free_lists_{};
+};
@@ -0,0 +1,370 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+#include "simd_algorithms.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace detail::packed
+{
+
+inline constexpr unsigned WORD_BITS = 64;
+
+inline constexpr uint64_t Mask(unsigned bits) noexcept
+{
+    return bits == WORD_BITS ? ~uint64_t{ 0 } : (uint64_t{ 1 } << bits) - 1;
+}
+
+//    size   bits    :   
+//    ,  Get       
+inline constexpr size_t WordCount(size_t size, unsigned bits) noexcept
+{
+    return (size * bits + WORD_BITS - 1) / WORD_BITS + 1;
+}
+
+inline uint64_t Get(const uint64_t* words, unsigned bits, size_t index) noexcept
+{
+    const size_t offset = index * bits;
+    const size_t word = offset / WORD_BITS;
+    const unsigned shift = offset % WORD_BITS;
+    //      0  shift == 0,    64   
+    const uint64_t high = (words[word + 1] << 1) << (WORD_BITS - 1 - shift);
+    return ((words[word] >> shift) | high) & Mask(bits);
+}
+
+// value    bits 
+inline void Set(uint64_t* words, unsigned bits, size_t index, uint64_t value) noexcept
+{
+    const size_t offset = index * bits;
+    const size_t word = offset / WORD_BITS;
+    const unsigned shift = offset % WORD_BITS;
+    const uint64_t mask = Mask(bits);
+    words[word] = (words[word] & ~(mask << shift)) | (value << shift);
+    if (shift + bits > WORD_BITS)
+    {
+        const unsigned low_bits = WORD_BITS - shift;
+        words[word + 1] = (words[word + 1] & ~(mask >> low_bits)) | (value >> low_bits);
+    }
+}
+
+namespace scalar
+{
+
+template <typename U>
+inline void Unpack(const uint64_t* words, unsigned bits, size_t first, size_t count, U* output) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        output[i] = static_cast<U>(Get(words, bits, first + i));
+    }
+}
+
+} // namespace scalar
+
+#if defined(VECTOR_SIMD_X86)
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace avx2
+{
+
+//    64-   ,    ,  
+//    7 :    (gather)      57 .
+//     little-endian,      
+inline __m256i UnpackFour(const long long* bytes, __m256i offsets, __m256i mask) noexcept
+{
+    const __m256i loaded = _mm256_i64gather_epi64(bytes, _mm256_srli_epi64(offsets, 3), 1);
+    return _mm256_and_si256(_mm256_srlv_epi64(loaded, _mm256_and_si256(offsets, _mm256_set1_epi64x(7))), mask);
+}
+
+template <typename U>
+inline void Unpack(const uint64_t* words, unsigned bits, size_t first, size_t count, U* output) noexcept
+{
+    const auto* bytes = reinterpret_cast<const long long*>(words);
+    const auto step = static_cast<long long>(bits);
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(Mask(bits)));
+    const __m256i advance = _mm256_set1_epi64x(4 * step);
+    __m256i offsets = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<long long>(first * bits)),
+        _mm256_setr_epi64x(0, step, 2 * step, 3 * step));
+    size_t i = 0;
+    if constexpr (sizeof(U) == sizeof(uint64_t))
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), UnpackFour(bytes, offsets, mask));
+            offsets = _mm256_add_epi64(offsets, advance);
+        }
+    }
+    else
+    {
+        //   64-        32-
+        const __m256i low_halves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i low = _mm256_permutevar8x32_epi32(UnpackFour(bytes, offsets, mask), low_halves);
+            offsets = _mm256_add_epi64(offsets, advance);
+            const __m256i high = _mm256_permutevar8x32_epi32(UnpackFour(bytes, offsets, mask), low_halves);
+            offsets = _mm256_add_epi64(offsets, advance);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permute2x128_si256(low, high, 0x20));
+        }
+    }
+    scalar::Unpack(words, bits, first + i, count - i, output + i);
+}
+
+} // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
+
+//   ,   AVX2   64- 
+inline constexpr unsigned MAX_GATHER_BITS = WORD_BITS - 7;
+
+template <typename U>
+inline void Unpack(const uint64_t* words, unsigned bits, size_t first, size_t count, U* output) noexcept
+{
+#if defined(VECTOR_SIMD_X86)
+    if (bits <= MAX_GATHER_BITS && ActiveSimdLevel() >= SimdLevel::Avx2)
+    {
+        return avx2::Unpack(words, bits, first, count, output);
+    }
+#endif
+    scalar::Unpack(words, bits, first, count, output);
+}
+
+} // namespace detail::packed
+
+//   ,   Bits()      64- .
+//      :  ,   ,
+//       (    64 ).
+//    :     ,  -  Set.
+// Unpack      uint32_t  uint64_t  AVX2,   
+template <typename GrowthPolicy = DoublingGrowth>
+class BasicPackedVector
+{
+public:
+    using value_type = uint64_t;
+    //   ,       
+    using const_iterator = detail::IndexIterator<const BasicPackedVector, uint64_t>;
+    using iterator = const_iterator;
+
+    BasicPackedVector() = default;
+
+    explicit BasicPackedVector(size_t size, uint64_t value = 0)
+        : bits_(static_cast<unsigned>(std::bit_width(value)))
+    {
+        Resize(size, value);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+    //    ,     
+    size_t Capacity() const noexcept
+    {
+        const size_t words = words_.Capacity();
+        if (bits_ == 0)
+        {
+            return words == 0 ? 0 : SIZE_MAX;
+        }
+        return words == 0 ? 0 : (words - 1) * detail::packed::WORD_BITS / bits_;
+    }
+    unsigned Bits() const noexcept
+    {
+        return bits_;
+    }
+    //    
+    size_t MemoryUsage() const noexcept
+    {
+        return words_.Capacity() * sizeof(uint64_t);
+    }
+
+    uint64_t operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return bits_ == 0 ? 0 : detail::packed::Get(words_.begin(), bits_, index);
+    }
+    uint64_t Back() const noexcept
+    {
+        assert(size_ > 0);
+        return (*this)[size_ - 1];
+    }
+
+    //  ,  value     
+    void Set(size_t index, uint64_t value)
+    {
+        assert(index < size_);
+        FitValue(value);
+        detail::packed::Set(words_.begin(), bits_, index, value);
+    }
+
+    //    new_capacity     bits.   
+    // ,          
+    void Reserve(size_t new_capacity, unsigned bits = 0)
+    {
+        assert(bits <= detail::packed::WORD_BITS);
+        if (bits > bits_)
+        {
+            Repack(bits, detail::packed::WordCount(size_, bits));
+        }
+        words_.Reserve(detail::packed::WordCount(new_capacity, bits_));
+    }
+
+    //     value
+    void Resize(size_t new_size, uint64_t value = 0);
+
+    void PushBack(uint64_t value);
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        --size_;
+    }
+
+    void Clear() noexcept
+    {
+        words_.Clear();
+        size_ = 0;
+    }
+
+    //          
+    void ShrinkToFit();
+
+    //  count    first  output.     U
+    template <typename U>
+        requires std::is_same_v<U, uint32_t> || std::is_same_v<U, uint64_t>
+    void Unpack(size_t first, size_t count, U* output) const noexcept
+    {
+        assert(first + count <= size_);
+        assert(bits_ <= sizeof(U) * 8);
+        if (bits_ == 0)
+        {
+            std::fill_n(output, count, U{ 0 });
+            return;
+        }
+        detail::packed::Unpack(words_.begin(), bits_, first, count, output);
+    }
+
+    //     first    output (Vector, SimdVector, std::vector),
+    //   
+    template <typename Range>
+        requires std::contiguous_iterator<decltype(std::begin(std::declval<Range&>()))>
+    void Unpack(size_t first, Range& output) const noexcept
+    {
+        Unpack(first, detail::simd::RangeSize(output), detail::simd::RangeData(output));
+    }
+
+    void Swap(BasicPackedVector& other) noexcept
+    {
+        words_.Swap(other.words_);
+        std::swap(size_, other.size_);
+        std::swap(bits_, other.bits_);
+    }
+
+private:
+    void FitValue(uint64_t value)
+    {
+        const auto bits = static_cast<unsigned>(std::bit_width(value));
+        if (bits > bits_)
+        {
+            Repack(bits, detail::packed::WordCount(size_, bits));
+        }
+    }
+
+    //      words   bits
+    void Repack(unsigned bits, size_t words);
+
+    Vector<uint64_t, std::allocator<uint64_t>, GrowthPolicy> words_;
+    size_t size_ = 0;
+    unsigned bits_ = 0;
+};
+
+template <typename GrowthPolicy>
+inline void BasicPackedVector<GrowthPolicy>::Resize(size_t new_size, uint64_t value)
+{
+    if (new_size > size_)
+    {
+        FitValue(value);
+        words_.Resize(std::max(words_.Size(), detail::packed::WordCount(new_size, bits_)));
+        for (size_t i = size_; i < new_size; ++i)
+        {
+            detail::packed::Set(words_.begin(), bits_, i, value);
+        }
+    }
+    size_ = new_size;
+}
+
+template <typename GrowthPolicy>
+inline void BasicPackedVector<GrowthPolicy>::PushBack(uint64_t value)
+{
+    FitValue(value);
+    //    ,      GrowthPolicy
+    while (words_.Size() < detail::packed::WordCount(size_ + 1, bits_))
+    {
+        words_.PushBack(0);
+    }
+    detail::packed::Set(words_.begin(), bits_, size_, value);
+    ++size_;
+}
+
+template <typename GrowthPolicy>
+inline void BasicPackedVector<GrowthPolicy>::ShrinkToFit()
+{
+    uint64_t all_bits = 0;
+    for (uint64_t value : *this)
+    {
+        all_bits |= value;
+    }
+    const auto bits = static_cast<unsigned>(std::bit_width(all_bits));
+    Repack(bits, size_ == 0 ? 0 : detail::packed::WordCount(size_, bits));
+    words_.ShrinkToFit();
+}
+
+template <typename GrowthPolicy>
+inline void BasicPackedVector<GrowthPolicy>::Repack(unsigned bits, size_t words)
+{
+    Vector<uint64_t, std::allocator<uint64_t>, GrowthPolicy> repacked(words);
+    for (size_t i = 0; i < size_; ++i)
+    {
+        detail::packed::Set(repacked.begin(), bits, i, (*this)[i]);
+    }
+    words_.Swap(repacked);
+    bits_ = bits;
+}
+
+using PackedVector = BasicPackedVector<>;
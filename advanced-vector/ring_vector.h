@@ -0,0 +1,528 @@
+#pragma once
+#include "vector.h"
+#include "allocators.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+//    RawMemory      O(1)   .
+//  -  ,     ,  .
+//       : Spans     .
+//         ,   .
+//     Vector:  ,      
+//  
+template <typename T, typename Allocator = std::allocator<T>>
+class RingVector
+{
+public:
+    using value_type = T;
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+    using iterator = detail::IndexIterator<RingVector, T&>;
+    using const_iterator = detail::IndexIterator<const RingVector, const T&>;
+
+private:
+    using AllocTraits = std::allocator_traits<allocator_type>;
+
+public:
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    RingVector() = default;
+
+    explicit RingVector(const allocator_type& alloc) noexcept
+        : data_(alloc)
+    {
+    }
+
+    RingVector(const RingVector& other)
+        : RingVector(other, std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.GetAllocator()))
+    {
+    }
+
+    RingVector(const RingVector& other, const allocator_type& alloc);
+
+    RingVector(RingVector&& other) noexcept
+        : data_(std::move(other.data_))
+        , head_(std::exchange(other.head_, 0))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    //     propagate_on_container_copy_assignment 
+    // propagate_on_container_move_assignment,   Vector
+    RingVector& operator=(const RingVector& rhs);
+
+    RingVector& operator=(RingVector&& rhs)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+    ~RingVector()
+    {
+        Clear();
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+    size_t Capacity() const noexcept
+    {
+        return data_.Capacity();
+    }
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<RingVector&>(*this)[index];
+    }
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return *Slot(index);
+    }
+    T& Front() noexcept
+    {
+        return (*this)[0];
+    }
+    T& Back() noexcept
+    {
+        return (*this)[size_ - 1];
+    }
+    const allocator_type& GetAllocator() const noexcept
+    {
+        return data_.GetAllocator();
+    }
+
+    //     ;  ,       
+    std::pair<std::span<T>, std::span<T>> Spans() noexcept
+    {
+        const size_t first = std::min(size_, Capacity() - head_);
+        return { std::span<T>(data_ + head_, first), std::span<T>(data_ + 0, size_ - first) };
+    }
+    std::pair<std::span<const T>, std::span<const T>> Spans() const noexcept
+    {
+        const auto [first, second] = const_cast<RingVector&>(*this).Spans();
+        return { first, second };
+    }
+
+    //      
+    void Reserve(size_t new_capacity);
+
+    void Clear() noexcept;
+
+    void Swap(RingVector& other) noexcept
+    {
+        data_.Swap(other.data_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    template <typename V>
+    void PushBack(V&& value)
+    {
+        EmplaceBack(std::forward<V>(value));
+    }
+
+    template <typename V>
+    void PushFront(V&& value)
+    {
+        EmplaceFront(std::forward<V>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args);
+
+    template <typename... Args>
+    T& EmplaceFront(Args&&... args);
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        detail::Destroy(Slot(size_ - 1));
+        --size_;
+    }
+
+    void PopFront() noexcept
+    {
+        assert(size_ > 0);
+        detail::Destroy(Slot(0));
+        head_ = (head_ + 1) & Mask();
+        --size_;
+    }
+
+private:
+    size_t Mask() const noexcept
+    {
+        return Capacity() - 1;
+    }
+
+    T* Slot(size_t index) noexcept
+    {
+        return data_ + ((head_ + index) & Mask());
+    }
+
+    size_t GrowthCapacity() const noexcept
+    {
+        return Capacity() == 0 ? MIN_CAPACITY : Capacity() * 2;
+    }
+
+    //      to ,   .
+    //    ,  to  ,    ;
+    //           
+    void UnrollTo(T* to);
+
+    //      ,    other.
+    //  ,   rhs   
+    void TakeOver(RingVector&& other) noexcept
+    {
+        Clear();
+        data_.Replace(std::move(other.data_));
+        head_ = std::exchange(other.head_, 0);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    //      new_capacity,      slot  
+    template <typename... Args>
+    T& GrowAndEmplace(size_t new_capacity, size_t slot, size_t new_head, Args&&... args);
+
+    RawMemory<T, Allocator> data_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+template <typename T, typename Allocator>
+inline RingVector<T, Allocator>::RingVector(const RingVector& other, const allocator_type& alloc)
+    : data_(other.size_ == 0 ? 0 : std::bit_ceil(other.size_), alloc)
+{
+    const auto [first, second] = other.Spans();
+    std::uninitialized_copy(first.begin(), first.end(), data_.GetAddress());
+    try
+    {
+        std::uninitialized_copy(second.begin(), second.end(), data_ + first.size());
+    }
+    catch (...)
+    {
+        std::destroy_n(data_.GetAddress(), first.size());
+        throw;
+    }
+    size_ = other.size_;
+}
+
+template <typename T, typename Allocator>
+inline RingVector<T, Allocator>& RingVector<T, Allocator>::operator=(const RingVector& rhs)
+{
+    if (this != &rhs)
+    {
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value
+            && !AllocTraits::is_always_equal::value)
+        {
+            if (GetAllocator() != rhs.GetAllocator())
+            {
+                RingVector rhs_copy(rhs, rhs.GetAllocator());
+                TakeOver(std::move(rhs_copy));
+                return *this;
+            }
+        }
+        RingVector rhs_copy(rhs, GetAllocator());
+        Swap(rhs_copy);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline RingVector<T, Allocator>& RingVector<T, Allocator>::operator=(RingVector&& rhs)
+    noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+    {
+        //  rhs     
+        TakeOver(std::move(rhs));
+    }
+    else
+    {
+        if constexpr (!AllocTraits::is_always_equal::value)
+        {
+            //    :    ,   
+            if (GetAllocator() != rhs.GetAllocator())
+            {
+                RingVector moved(GetAllocator());
+                moved.Reserve(rhs.size_);
+                rhs.UnrollTo(moved.data_.GetAddress());
+                moved.size_ = std::exchange(rhs.size_, 0);
+                rhs.head_ = 0;
+                Swap(moved);
+                return *this;
+            }
+        }
+        Clear();
+        Swap(rhs);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline void RingVector<T, Allocator>::Clear() noexcept
+{
+    const auto [first, second] = Spans();
+    std::destroy(first.begin(), first.end());
+    std::destroy(second.begin(), second.end());
+    head_ = 0;
+    size_ = 0;
+}
+
+template <typename T, typename Allocator>
+inline void RingVector<T, Allocator>::UnrollTo(T* to)
+{
+    const auto [first, second] = Spans();
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+    {
+        detail::RelocateBytes(to, first.data(), first.size());
+        detail::RelocateBytes(to + first.size(), second.data(), second.size());
+    }
+    else
+    {
+        const auto transfer = [](std::span<T> from, T* dest) {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            {
+                std::uninitialized_move(from.begin(), from.end(), dest);
+            }
+            else
+            {
+                std::uninitialized_copy(from.begin(), from.end(), dest);
+            }
+        };
+        transfer(first, to);
+        try
+        {
+            transfer(second, to + first.size());
+        }
+        catch (...)
+        {
+            //       .   
+            //    ,       
+            std::destroy_n(to, first.size());
+            throw;
+        }
+        std::destroy(first.begin(), first.end());
+        std::destroy(second.begin(), second.end());
+    }
+}
+
+template <typename T, typename Allocator>
+inline void RingVector<T, Allocator>::Reserve(size_t new_capacity)
+{
+    if (new_capacity <= Capacity())
+    {
+        return;
+    }
+    RawMemory<T, Allocator> new_data(std::bit_ceil(new_capacity), GetAllocator());
+    UnrollTo(new_data.GetAddress());
+    data_.Swap(new_data);
+    head_ = 0;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline T& RingVector<T, Allocator>::GrowAndEmplace(size_t new_capacity, size_t slot, size_t new_head, Args&&... args)
+{
+    RawMemory<T, Allocator> new_data(new_capacity, GetAllocator());
+    //      ,      
+    T* elem = detail::ForwardConstruct(new_data + slot, std::forward<Args>(args)...);
+    try
+    {
+        UnrollTo(new_data.GetAddress());
+    }
+    catch (...)
+    {
+        detail::Destroy(elem);
+        throw;
+    }
+    data_.Swap(new_data);
+    head_ = new_head;
+    ++size_;
+    return *elem;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline T& RingVector<T, Allocator>::EmplaceBack(Args&&... args)
+{
+    if (size_ == Capacity())
+    {
+        return GrowAndEmplace(GrowthCapacity(), size_, 0, std::forward<Args>(args)...);
+    }
+    T* elem = detail::ForwardConstruct(Slot(size_), std::forward<Args>(args)...);
+    ++size_;
+    return *elem;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline T& RingVector<T, Allocator>::EmplaceFront(Args&&... args)
+{
+    if (size_ == Capacity())
+    {
+        const size_t new_capacity = GrowthCapacity();
+        return GrowAndEmplace(new_capacity, new_capacity - 1, new_capacity - 1, std::forward<Args>(args)...);
+    }
+    const size_t new_head = (head_ - 1) & Mask();
+    T* elem = detail::ForwardConstruct(data_ + new_head, std::forward<Args>(args)...);
+    head_ = new_head;
+    ++size_;
+    return *elem;
+}
+
+//         -  
+// -  .    TryPush/TryEmplace,  -
+//  TryPop/ConsumeAll.          ;
+//        -,      
+// ,  ,       
+template <typename T, typename Allocator = std::allocator<T>>
+class SpscRing
+{
+public:
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+
+    //      
+    explicit SpscRing(size_t capacity, const allocator_type& alloc = allocator_type())
+        : data_(std::bit_ceil(std::max<size_t>(capacity, 1)), alloc)
+        , mask_(data_.Capacity() - 1)
+    {
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    ~SpscRing()
+    {
+        for (size_t i = head_.load(std::memory_order_relaxed); i != tail_.load(std::memory_order_relaxed); ++i)
+        {
+            detail::Destroy(data_ + (i & mask_));
+        }
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return mask_ + 1;
+    }
+
+    //     ,      
+    size_t SizeApprox() const noexcept
+    {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    // .  false,   
+    template <typename... Args>
+    bool TryEmplace(Args&&... args)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == Capacity())
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity())
+            {
+                return false;
+            }
+        }
+        detail::ForwardConstruct(data_ + (tail & mask_), std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename V>
+    bool TryPush(V&& value)
+    {
+        return TryEmplace(std::forward<V>(value));
+    }
+
+    // .     out;  false,   
+    bool TryPop(T& out)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+            {
+                return false;
+            }
+        }
+        T* elem = data_ + (head & mask_);
+        out = std::move(*elem);
+        detail::Destroy(elem);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // .  visitor(T&)  ,    ,  
+    //    .  visitor  ,    
+    template <typename Visitor>
+    size_t ConsumeAll(Visitor visitor)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        size_t i = head;
+        try
+        {
+            for (; i != cached_tail_; ++i)
+            {
+                T* elem = data_ + (i & mask_);
+                visitor(*elem);
+                detail::Destroy(elem);
+            }
+        }
+        catch (...)
+        {
+            detail::Destroy(data_ + (i & mask_));
+            head_.store(i + 1, std::memory_order_release);
+            throw;
+        }
+        head_.store(i, std::memory_order_release);
+        return i - head;
+    }
+
+private:
+    RawMemory<T, Allocator> data_;
+    const size_t mask_;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{ 0 };
+    size_t cached_tail_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{ 0 };
+    size_t cached_head_ = 0;
+};
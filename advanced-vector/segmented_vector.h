@@ -0,0 +1,466 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+//     :  k  FirstSegment << k .
+//         ,    
+//   O(1)   ,        
+// ( ,   Insert  Erase).    - O(1):       .
+// EmplaceBack  PushBack   ; Emplace  Erase    ,  Vector
+template <typename T, typename Allocator = std::allocator<T>, size_t FirstSegment = 16>
+class SegmentedVector
+{
+    static_assert(std::has_single_bit(FirstSegment), "Segment sizes must be powers of two");
+
+public:
+    using value_type = T;
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+    using iterator = detail::IndexIterator<SegmentedVector, T&>;
+    using const_iterator = detail::IndexIterator<const SegmentedVector, const T&>;
+
+private:
+    using AllocTraits = std::allocator_traits<allocator_type>;
+
+public:
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(const allocator_type& alloc) noexcept;
+
+    explicit SegmentedVector(size_t size, const allocator_type& alloc = allocator_type());
+
+    SegmentedVector(const SegmentedVector& other);
+
+    SegmentedVector(const SegmentedVector& other, const allocator_type& alloc);
+
+    SegmentedVector(SegmentedVector&& other) noexcept;
+
+    //     propagate_on_container_copy_assignment 
+    // propagate_on_container_move_assignment,   Vector
+    SegmentedVector& operator=(const SegmentedVector& rhs);
+    SegmentedVector& operator=(SegmentedVector&& rhs)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+    ~SegmentedVector();
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+    size_t Capacity() const noexcept
+    {
+        return detail::SegmentStart(segments_.Size(), FIRST_LOG2);
+    }
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<SegmentedVector&>(*this)[index];
+    }
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return *Slot(index);
+    }
+    const allocator_type& GetAllocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    void Reserve(size_t new_capacity);
+    void Resize(size_t new_size);
+
+    //  ,     propagate_on_container_swap,
+    //     
+    void Swap(SegmentedVector& other) noexcept;
+
+    //  ,  
+    void Clear() noexcept;
+
+    //  ,    
+    void ShrinkToFit() noexcept;
+
+    template <typename V>
+    void PushBack(V&& value);
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args);
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args);
+
+    template <typename V>
+    iterator Insert(const_iterator pos, V&& value)
+    {
+        return Emplace(pos, std::forward<V>(value));
+    }
+
+    void PopBack() noexcept;
+    T& Back() noexcept;
+    iterator Erase(const_iterator pos);
+    iterator Erase(const_iterator first, const_iterator last);
+
+private:
+    static constexpr unsigned FIRST_LOG2 = static_cast<unsigned>(std::countr_zero(FirstSegment));
+    static constexpr size_t MAX_SEGMENTS = detail::MaxSegmentCount(FIRST_LOG2);
+
+    using Segment = RawMemory<T, Allocator>;
+    using SegmentTableAllocator = typename std::allocator_traits<allocator_type>::template rebind_alloc<Segment>;
+
+    T* Slot(size_t index) noexcept
+    {
+        const detail::SegmentPosition pos = detail::LocateSegment(index, FIRST_LOG2);
+        return segments_[pos.segment] + pos.offset;
+    }
+
+    void AddSegment();
+
+    //       new_size
+    void DestroyFrom(size_t new_size) noexcept;
+
+    //      ,     other.
+    //  ,   rhs   
+    void TakeOver(SegmentedVector&& other);
+
+    allocator_type alloc_;
+    Vector<Segment, SegmentTableAllocator> segments_{ SegmentTableAllocator(alloc_) };
+    size_t size_ = 0;
+};
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::SegmentedVector(const allocator_type& alloc) noexcept
+    : alloc_(alloc)
+{
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::SegmentedVector(size_t size, const allocator_type& alloc)
+    : alloc_(alloc)
+{
+    Resize(size);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::SegmentedVector(const SegmentedVector& other)
+    : SegmentedVector(other, AllocTraits::select_on_container_copy_construction(other.alloc_))
+{
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::SegmentedVector(const SegmentedVector& other, const allocator_type& alloc)
+    : alloc_(alloc)
+{
+    Reserve(other.size_);
+    try
+    {
+        for (const T& value : other)
+        {
+            new (Slot(size_)) T(value);
+            ++size_;
+        }
+    }
+    catch (...)
+    {
+        DestroyFrom(0);
+        throw;
+    }
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::SegmentedVector(SegmentedVector&& other) noexcept
+    : alloc_(other.alloc_)
+    , segments_(std::move(other.segments_))
+    , size_(std::exchange(other.size_, 0))
+{
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>& SegmentedVector<T, Allocator, FirstSegment>::operator=(const SegmentedVector& rhs)
+{
+    if (this != &rhs)
+    {
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value
+            && !AllocTraits::is_always_equal::value)
+        {
+            if (alloc_ != rhs.alloc_)
+            {
+                SegmentedVector rhs_copy(rhs, rhs.alloc_);
+                TakeOver(std::move(rhs_copy));
+                return *this;
+            }
+        }
+        if (rhs.size_ > Capacity())
+        {
+            SegmentedVector rhs_copy(rhs, alloc_);
+            Swap(rhs_copy);
+        }
+        else
+        {
+            const size_t common = std::min(size_, rhs.size_);
+            std::copy_n(rhs.begin(), common, begin());
+            if (rhs.size_ < size_)
+            {
+                DestroyFrom(rhs.size_);
+            }
+            else
+            {
+                for (; size_ < rhs.size_; ++size_)
+                {
+                    new (Slot(size_)) T(rhs[size_]);
+                }
+            }
+        }
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>& SegmentedVector<T, Allocator, FirstSegment>::operator=(SegmentedVector&& rhs)
+    noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+    {
+        //  rhs     
+        TakeOver(std::move(rhs));
+    }
+    else
+    {
+        if constexpr (!AllocTraits::is_always_equal::value)
+        {
+            //    :      
+            if (alloc_ != rhs.alloc_)
+            {
+                SegmentedVector moved(alloc_);
+                moved.Reserve(rhs.size_);
+                for (T& value : rhs)
+                {
+                    new (moved.Slot(moved.size_)) T(std::move(value));
+                    ++moved.size_;
+                }
+                Swap(moved);
+                return *this;
+            }
+        }
+        SegmentedVector moved(std::move(rhs));
+        Swap(moved);
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline SegmentedVector<T, Allocator, FirstSegment>::~SegmentedVector()
+{
+    DestroyFrom(0);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::Swap(SegmentedVector& other) noexcept
+{
+    using std::swap;
+    if constexpr (AllocTraits::propagate_on_container_swap::value)
+    {
+        swap(alloc_, other.alloc_);
+    }
+    else
+    {
+        assert(alloc_ == other.alloc_);
+    }
+    segments_.Swap(other.segments_);
+    swap(size_, other.size_);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::TakeOver(SegmentedVector&& other)
+{
+    DestroyFrom(0);
+    alloc_ = std::move(other.alloc_);
+    //    ,   
+    segments_ = std::move(other.segments_);
+    size_ = std::exchange(other.size_, 0);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::AddSegment()
+{
+    if (segments_.Size() == MAX_SEGMENTS)
+    {
+        throw std::length_error("SegmentedVector is too large");
+    }
+    segments_.EmplaceBack(detail::SegmentSize(segments_.Size(), FIRST_LOG2), alloc_);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::DestroyFrom(size_t new_size) noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (size_t i = new_size; i < size_; ++i)
+        {
+            std::destroy_at(Slot(i));
+        }
+    }
+    size_ = std::min(size_, new_size);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::Reserve(size_t new_capacity)
+{
+    while (Capacity() < new_capacity)
+    {
+        AddSegment();
+    }
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::Resize(size_t new_size)
+{
+    if (new_size <= size_)
+    {
+        DestroyFrom(new_size);
+        return;
+    }
+    Reserve(new_size);
+    const size_t old_size = size_;
+    try
+    {
+        for (; size_ < new_size; ++size_)
+        {
+            new (Slot(size_)) T();
+        }
+    }
+    catch (...)
+    {
+        DestroyFrom(old_size);
+        throw;
+    }
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::Clear() noexcept
+{
+    DestroyFrom(0);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::ShrinkToFit() noexcept
+{
+    while (segments_.Size() != 0 && detail::SegmentStart(segments_.Size() - 1, FIRST_LOG2) >= size_)
+    {
+        segments_.PopBack();
+    }
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+template <typename V>
+inline void SegmentedVector<T, Allocator, FirstSegment>::PushBack(V&& value)
+{
+    EmplaceBack(std::forward<V>(value));
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+template <typename... Args>
+inline T& SegmentedVector<T, Allocator, FirstSegment>::EmplaceBack(Args&&... args)
+{
+    //   ,  ,   ,  
+    if (size_ == Capacity())
+    {
+        AddSegment();
+    }
+    T* slot = Slot(size_);
+    new (slot) T(std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+template <typename... Args>
+inline typename SegmentedVector<T, Allocator, FirstSegment>::iterator
+SegmentedVector<T, Allocator, FirstSegment>::Emplace(const_iterator pos, Args&&... args)
+{
+    assert(pos >= cbegin() && pos <= cend());
+    const size_t pos_t = pos.Index();
+    if (pos_t == size_)
+    {
+        EmplaceBack(std::forward<Args>(args)...);
+        return begin() + pos_t;
+    }
+    if (size_ == Capacity())
+    {
+        AddSegment();
+    }
+    detail::ShiftInsert(begin() + pos_t, end(), Slot(size_), std::forward<Args>(args)...);
+    ++size_;
+    return begin() + pos_t;
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline void SegmentedVector<T, Allocator, FirstSegment>::PopBack() noexcept
+{
+    assert(size_ > 0);
+    --size_;
+    std::destroy_at(Slot(size_));
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline T& SegmentedVector<T, Allocator, FirstSegment>::Back() noexcept
+{
+    assert(size_ > 0);
+    return *Slot(size_ - 1);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline typename SegmentedVector<T, Allocator, FirstSegment>::iterator
+SegmentedVector<T, Allocator, FirstSegment>::Erase(const_iterator pos)
+{
+    assert(pos >= cbegin() && pos < cend());
+    return Erase(pos, pos + 1);
+}
+
+template <typename T, typename Allocator, size_t FirstSegment>
+inline typename SegmentedVector<T, Allocator, FirstSegment>::iterator
+SegmentedVector<T, Allocator, FirstSegment>::Erase(const_iterator first, const_iterator last)
+{
+    assert(first >= cbegin() && first <= last && last <= cend());
+    const size_t first_t = first.Index();
+    const size_t last_t = last.Index();
+    std::move(begin() + last_t, end(), begin() + first_t);
+    DestroyFrom(size_ - (last_t - first_t));
+    return begin() + first_t;
+}
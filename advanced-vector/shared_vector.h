@@ -0,0 +1,193 @@
+#pragma once
+#include "vector.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+//        .  SharedVector  O(1):  
+//      Vector.   Mutate   
+// ( ),      ,  ,  ,  .
+//   SharedVector,   std::shared_ptr,      ,
+//            
+template <typename T, typename Allocator = std::allocator<T>>
+class SharedVector
+{
+public:
+    using vector_type = Vector<T, Allocator>;
+    using allocator_type = typename vector_type::allocator_type;
+    using const_iterator = typename vector_type::const_iterator;
+
+    SharedVector() = default;
+
+    //   vector  
+    explicit SharedVector(vector_type&& vector)
+        : data_(std::allocate_shared<vector_type>(vector.GetAllocator(), std::move(vector)))
+    {
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return data_ ? data_->cbegin() : nullptr;
+    }
+    const_iterator cend() const noexcept
+    {
+        return data_ ? data_->cend() : nullptr;
+    }
+
+    size_t Size() const noexcept
+    {
+        return data_ ? data_->Size() : 0;
+    }
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(index < Size());
+        return (*data_)[index];
+    }
+
+    //   
+    const vector_type& View() const noexcept
+    {
+        static const vector_type EMPTY;
+        return data_ ? *data_ : EMPTY;
+    }
+
+    //      .  ,     ,  
+    bool IsShared() const noexcept
+    {
+        if (data_ && data_.use_count() > 1)
+        {
+            return true;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return false;
+    }
+
+    //   .   ,  ,      .
+    //  ,     
+    vector_type& Mutate()
+    {
+        if (!data_)
+        {
+            data_ = std::allocate_shared<vector_type>(allocator_type());
+        }
+        else if (data_.use_count() > 1)
+        {
+            //       1:       
+            data_ = std::allocate_shared<vector_type>(data_->GetAllocator(), *data_);
+        }
+        else
+        {
+            // use_count   relaxed-:       
+            //     ,      
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *data_;
+    }
+
+    template <typename V>
+    void PushBack(V&& value)
+    {
+        Mutate().PushBack(std::forward<V>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        return Mutate().EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void Clear() noexcept
+    {
+        data_.reset();
+    }
+
+    void Swap(SharedVector& other) noexcept
+    {
+        data_.swap(other.data_);
+    }
+
+private:
+    template <typename, typename>
+    friend class PublishedVector;
+
+    explicit SharedVector(std::shared_ptr<vector_type> data) noexcept
+        : data_(std::move(data))
+    {
+    }
+
+    std::shared_ptr<vector_type> data_;
+};
+
+//        RCU:   ,    
+//    ,         .
+//      ;  ,     ,
+//     .       :
+// std::atomic<std::shared_ptr>  libstdc++ 12   ,     release-
+template <typename T, typename Allocator = std::allocator<T>>
+class PublishedVector
+{
+public:
+    using snapshot_type = SharedVector<T, Allocator>;
+
+    PublishedVector() = default;
+
+    explicit PublishedVector(snapshot_type initial)
+        : current_(std::move(initial.data_))
+    {
+    }
+
+    PublishedVector(const PublishedVector&) = delete;
+    PublishedVector& operator=(const PublishedVector&) = delete;
+
+    snapshot_type Snapshot() const
+    {
+        std::lock_guard guard(mutex_);
+        return snapshot_type(current_);
+    }
+
+    void Publish(snapshot_type version)
+    {
+        {
+            std::lock_guard guard(mutex_);
+            current_.swap(version.data_);
+        }
+        //    ,  ,      
+    }
+
+    //     : update(Vector&)   .
+    //       , update     
+    template <typename Update>
+    void Modify(Update update)
+    {
+        snapshot_type next = Snapshot();
+        while (true)
+        {
+            const std::shared_ptr<Vector<T, Allocator>> base = next.data_;
+            update(next.Mutate());
+            std::unique_lock guard(mutex_);
+            if (current_ == base)
+            {
+                current_.swap(next.data_);
+                guard.unlock();
+                return;
+            }
+            next.data_ = current_;
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<Vector<T, Allocator>> current_;
+};
@@ -0,0 +1,627 @@
+#pragma once
+#include "vector.h"
+#include "allocators.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_SIMD_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define VECTOR_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+//      : Fill, Find, Count, Sum, MinMax  Transform.
+//  float, double, int32_t  int64_t   AVX2  AVX-512 (   
+//   )  NEON.       .
+//         ,
+//   SimdVector,   64 ,   .
+//    Sum  ,   MinMax    NaN  
+
+//       
+enum class SimdLevel
+{
+    Scalar,
+    Neon,
+    Avx2,
+    Avx512,
+};
+
+//   ,     
+inline SimdLevel DetectSimdLevel() noexcept
+{
+#if defined(VECTOR_SIMD_X86)
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SimdLevel::Avx2;
+    }
+    return SimdLevel::Scalar;
+#elif defined(VECTOR_SIMD_NEON)
+    return SimdLevel::Neon;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+//      AVX-512
+template <typename T>
+using SimdVector = Vector<T, AlignedAllocator<T, 64>>;
+
+//   Sum:    64-    
+template <typename T>
+using SumType = std::conditional_t<std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+namespace detail::simd
+{
+
+inline std::atomic<SimdLevel>& Level() noexcept
+{
+    static std::atomic<SimdLevel> level{ DetectSimdLevel() };
+    return level;
+}
+
+template <typename T>
+inline constexpr bool HAS_KERNELS = std::is_same_v<T, float> || std::is_same_v<T, double>
+    || std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+template <typename Range>
+using RangeValue = std::remove_cvref_t<decltype(*std::begin(std::declval<Range&>()))>;
+
+template <typename Range>
+concept ArithmeticRange = std::contiguous_iterator<decltype(std::begin(std::declval<Range&>()))>
+    && std::is_arithmetic_v<RangeValue<Range>>;
+
+template <typename Range>
+auto* RangeData(Range& range) noexcept
+{
+    return std::to_address(std::begin(range));
+}
+
+template <typename Range>
+size_t RangeSize(Range& range) noexcept
+{
+    return static_cast<size_t>(std::end(range) - std::begin(range));
+}
+
+namespace scalar
+{
+
+template <typename T>
+inline void Fill(T* data, size_t n, T value) noexcept
+{
+    std::fill_n(data, n, value);
+}
+
+template <typename T>
+inline size_t Find(const T* data, size_t n, T value) noexcept
+{
+    return static_cast<size_t>(std::find(data, data + n, value) - data);
+}
+
+template <typename T>
+inline size_t Count(const T* data, size_t n, T value) noexcept
+{
+    return static_cast<size_t>(std::count(data, data + n, value));
+}
+
+template <typename T>
+inline SumType<T> Sum(const T* data, size_t n) noexcept
+{
+    SumType<T> sum = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
+template <typename T>
+inline std::pair<T, T> MinMax(const T* data, size_t n) noexcept
+{
+    assert(n != 0);
+    T min = data[0];
+    T max = data[0];
+    for (size_t i = 1; i < n; ++i)
+    {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+    }
+    return { min, max };
+}
+
+template <typename T, typename U, typename Operation>
+inline void Transform(const T* input, size_t n, U* output, Operation& operation)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        output[i] = operation(input[i]);
+    }
+}
+
+} // namespace scalar
+
+#if defined(VECTOR_SIMD_X86)
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace avx2
+{
+
+template <typename T>
+struct Ops;
+
+template <>
+struct Ops<float>
+{
+    using Reg = __m256;
+    using Acc = __m256;
+    static constexpr size_t WIDTH = 8;
+    static constexpr size_t ACC_WIDTH = 8;
+
+    static Reg Load(const float* p) { return _mm256_load_ps(p); }
+    static void Store(float* p, Reg r) { _mm256_store_ps(p, r); }
+    static Reg Set1(float v) { return _mm256_set1_ps(v); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ))); }
+    static Acc Zero() { return _mm256_setzero_ps(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm256_add_ps(acc, r); }
+    static void StoreAcc(float* p, Acc acc) { _mm256_storeu_ps(p, acc); }
+};
+
+template <>
+struct Ops<double>
+{
+    using Reg = __m256d;
+    using Acc = __m256d;
+    static constexpr size_t WIDTH = 4;
+    static constexpr size_t ACC_WIDTH = 4;
+
+    static Reg Load(const double* p) { return _mm256_load_pd(p); }
+    static void Store(double* p, Reg r) { _mm256_store_pd(p, r); }
+    static Reg Set1(double v) { return _mm256_set1_pd(v); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+    static Acc Zero() { return _mm256_setzero_pd(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm256_add_pd(acc, r); }
+    static void StoreAcc(double* p, Acc acc) { _mm256_storeu_pd(p, acc); }
+};
+
+template <>
+struct Ops<int32_t>
+{
+    using Reg = __m256i;
+    //  64- :       
+    struct Acc
+    {
+        __m256i low;
+        __m256i high;
+    };
+    static constexpr size_t WIDTH = 8;
+    static constexpr size_t ACC_WIDTH = 8;
+
+    static Reg Load(const int32_t* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void Store(int32_t* p, Reg r) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), r); }
+    static Reg Set1(int32_t v) { return _mm256_set1_epi32(v); }
+    static Reg Min(Reg a, Reg b) { return _mm256_min_epi32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm256_max_epi32(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)))); }
+    static Acc Zero() { return { _mm256_setzero_si256(), _mm256_setzero_si256() }; }
+    static Acc Accumulate(Acc acc, Reg r)
+    {
+        return { _mm256_add_epi64(acc.low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(r))),
+            _mm256_add_epi64(acc.high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(r, 1))) };
+    }
+    static void StoreAcc(int64_t* p, Acc acc)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), acc.low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + 4), acc.high);
+    }
+};
+
+template <>
+struct Ops<int64_t>
+{
+    using Reg = __m256i;
+    using Acc = __m256i;
+    static constexpr size_t WIDTH = 4;
+    static constexpr size_t ACC_WIDTH = 4;
+
+    static Reg Load(const int64_t* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void Store(int64_t* p, Reg r) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), r); }
+    static Reg Set1(int64_t v) { return _mm256_set1_epi64x(v); }
+    //  AVX2  min/max  64- :      
+    static Reg Min(Reg a, Reg b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static Reg Max(Reg a, Reg b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    static uint64_t EqMask(Reg a, Reg b) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)))); }
+    static Acc Zero() { return _mm256_setzero_si256(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm256_add_epi64(acc, r); }
+    static void StoreAcc(int64_t* p, Acc acc) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), acc); }
+};
+
+#include "simd_kernels.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+//  AVX-512  GCC     ,    
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512
+{
+
+template <typename T>
+struct Ops;
+
+template <>
+struct Ops<float>
+{
+    using Reg = __m512;
+    using Acc = __m512;
+    static constexpr size_t WIDTH = 16;
+    static constexpr size_t ACC_WIDTH = 16;
+
+    static Reg Load(const float* p) { return _mm512_load_ps(p); }
+    static void Store(float* p, Reg r) { _mm512_store_ps(p, r); }
+    static Reg Set1(float v) { return _mm512_set1_ps(v); }
+    static Reg Min(Reg a, Reg b) { return _mm512_min_ps(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm512_max_ps(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static Acc Zero() { return _mm512_setzero_ps(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm512_add_ps(acc, r); }
+    static void StoreAcc(float* p, Acc acc) { _mm512_storeu_ps(p, acc); }
+};
+
+template <>
+struct Ops<double>
+{
+    using Reg = __m512d;
+    using Acc = __m512d;
+    static constexpr size_t WIDTH = 8;
+    static constexpr size_t ACC_WIDTH = 8;
+
+    static Reg Load(const double* p) { return _mm512_load_pd(p); }
+    static void Store(double* p, Reg r) { _mm512_store_pd(p, r); }
+    static Reg Set1(double v) { return _mm512_set1_pd(v); }
+    static Reg Min(Reg a, Reg b) { return _mm512_min_pd(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm512_max_pd(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static Acc Zero() { return _mm512_setzero_pd(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm512_add_pd(acc, r); }
+    static void StoreAcc(double* p, Acc acc) { _mm512_storeu_pd(p, acc); }
+};
+
+template <>
+struct Ops<int32_t>
+{
+    using Reg = __m512i;
+    struct Acc
+    {
+        __m512i low;
+        __m512i high;
+    };
+    static constexpr size_t WIDTH = 16;
+    static constexpr size_t ACC_WIDTH = 16;
+
+    static Reg Load(const int32_t* p) { return _mm512_load_si512(p); }
+    static void Store(int32_t* p, Reg r) { _mm512_store_si512(p, r); }
+    static Reg Set1(int32_t v) { return _mm512_set1_epi32(v); }
+    static Reg Min(Reg a, Reg b) { return _mm512_min_epi32(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm512_max_epi32(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return _mm512_cmpeq_epi32_mask(a, b); }
+    static Acc Zero() { return { _mm512_setzero_si512(), _mm512_setzero_si512() }; }
+    static Acc Accumulate(Acc acc, Reg r)
+    {
+        return { _mm512_add_epi64(acc.low, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(r))),
+            _mm512_add_epi64(acc.high, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(r, 1))) };
+    }
+    static void StoreAcc(int64_t* p, Acc acc)
+    {
+        _mm512_storeu_si512(p, acc.low);
+        _mm512_storeu_si512(p + 8, acc.high);
+    }
+};
+
+template <>
+struct Ops<int64_t>
+{
+    using Reg = __m512i;
+    using Acc = __m512i;
+    static constexpr size_t WIDTH = 8;
+    static constexpr size_t ACC_WIDTH = 8;
+
+    static Reg Load(const int64_t* p) { return _mm512_load_si512(p); }
+    static void Store(int64_t* p, Reg r) { _mm512_store_si512(p, r); }
+    static Reg Set1(int64_t v) { return _mm512_set1_epi64(v); }
+    static Reg Min(Reg a, Reg b) { return _mm512_min_epi64(a, b); }
+    static Reg Max(Reg a, Reg b) { return _mm512_max_epi64(a, b); }
+    static uint64_t EqMask(Reg a, Reg b) { return _mm512_cmpeq_epi64_mask(a, b); }
+    static Acc Zero() { return _mm512_setzero_si512(); }
+    static Acc Accumulate(Acc acc, Reg r) { return _mm512_add_epi64(acc, r); }
+    static void StoreAcc(int64_t* p, Acc acc) { _mm512_storeu_si512(p, acc); }
+};
+
+#include "simd_kernels.inl"
+
+} // namespace avx512
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#elif defined(VECTOR_SIMD_NEON)
+
+namespace neon
+{
+
+template <typename T>
+struct Ops;
+
+//  NEON  movemask:    ,   
+template <>
+struct Ops<float>
+{
+    using Reg = float32x4_t;
+    using Acc = float32x4_t;
+    static constexpr size_t WIDTH = 4;
+    static constexpr size_t ACC_WIDTH = 4;
+
+    static Reg Load(const float* p) { return vld1q_f32(p); }
+    static void Store(float* p, Reg r) { vst1q_f32(p, r); }
+    static Reg Set1(float v) { return vdupq_n_f32(v); }
+    static Reg Min(Reg a, Reg b) { return vminq_f32(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_f32(a, b); }
+    static uint64_t EqMask(Reg a, Reg b)
+    {
+        static constexpr uint32_t BITS[4] = { 1, 2, 4, 8 };
+        return vaddvq_u32(vandq_u32(vceqq_f32(a, b), vld1q_u32(BITS)));
+    }
+    static Acc Zero() { return vdupq_n_f32(0); }
+    static Acc Accumulate(Acc acc, Reg r) { return vaddq_f32(acc, r); }
+    static void StoreAcc(float* p, Acc acc) { vst1q_f32(p, acc); }
+};
+
+template <>
+struct Ops<double>
+{
+    using Reg = float64x2_t;
+    using Acc = float64x2_t;
+    static constexpr size_t WIDTH = 2;
+    static constexpr size_t ACC_WIDTH = 2;
+
+    static Reg Load(const double* p) { return vld1q_f64(p); }
+    static void Store(double* p, Reg r) { vst1q_f64(p, r); }
+    static Reg Set1(double v) { return vdupq_n_f64(v); }
+    static Reg Min(Reg a, Reg b) { return vminq_f64(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_f64(a, b); }
+    static uint64_t EqMask(Reg a, Reg b)
+    {
+        static constexpr uint64_t BITS[2] = { 1, 2 };
+        return vaddvq_u64(vandq_u64(vceqq_f64(a, b), vld1q_u64(BITS)));
+    }
+    static Acc Zero() { return vdupq_n_f64(0); }
+    static Acc Accumulate(Acc acc, Reg r) { return vaddq_f64(acc, r); }
+    static void StoreAcc(double* p, Acc acc) { vst1q_f64(p, acc); }
+};
+
+template <>
+struct Ops<int32_t>
+{
+    using Reg = int32x4_t;
+    using Acc = int64x2_t;
+    static constexpr size_t WIDTH = 4;
+    static constexpr size_t ACC_WIDTH = 2;
+
+    static Reg Load(const int32_t* p) { return vld1q_s32(p); }
+    static void Store(int32_t* p, Reg r) { vst1q_s32(p, r); }
+    static Reg Set1(int32_t v) { return vdupq_n_s32(v); }
+    static Reg Min(Reg a, Reg b) { return vminq_s32(a, b); }
+    static Reg Max(Reg a, Reg b) { return vmaxq_s32(a, b); }
+    static uint64_t EqMask(Reg a, Reg b)
+    {
+        static constexpr uint32_t BITS[4] = { 1, 2, 4, 8 };
+        return vaddvq_u32(vandq_u32(vceqq_s32(a, b), vld1q_u32(BITS)));
+    }
+    static Acc Zero() { return vdupq_n_s64(0); }
+    //        64 
+    static Acc Accumulate(Acc acc, Reg r) { return vpadalq_s32(acc, r); }
+    static void StoreAcc(int64_t* p, Acc acc) { vst1q_s64(p, acc); }
+};
+
+template <>
+struct Ops<int64_t>
+{
+    using Reg = int64x2_t;
+    using Acc = int64x2_t;
+    static constexpr size_t WIDTH = 2;
+    static constexpr size_t ACC_WIDTH = 2;
+
+    static Reg Load(const int64_t* p) { return vld1q_s64(p); }
+    static void Store(int64_t* p, Reg r) { vst1q_s64(p, r); }
+    static Reg Set1(int64_t v) { return vdupq_n_s64(v); }
+    static Reg Min(Reg a, Reg b) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+    static Reg Max(Reg a, Reg b) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+    static uint64_t EqMask(Reg a, Reg b)
+    {
+        static constexpr uint64_t BITS[2] = { 1, 2 };
+        return vaddvq_u64(vandq_u64(vceqq_s64(a, b), vld1q_u64(BITS)));
+    }
+    static Acc Zero() { return vdupq_n_s64(0); }
+    static Acc Accumulate(Acc acc, Reg r) { return vaddq_s64(acc, r); }
+    static void StoreAcc(int64_t* p, Acc acc) { vst1q_s64(p, acc); }
+};
+
+#include "simd_kernels.inl"
+
+} // namespace neon
+
+#endif
+
+} // namespace detail::simd
+
+//  ,   
+inline SimdLevel ActiveSimdLevel() noexcept
+{
+    return detail::simd::Level().load(std::memory_order_relaxed);
+}
+
+//       level.      
+inline void SetSimdLevel(SimdLevel level) noexcept
+{
+    detail::simd::Level().store(std::min(level, DetectSimdLevel()), std::memory_order_relaxed);
+}
+
+//  call       .
+//           
+#define VECTOR_SIMD_DISPATCH(T, call)                                          \
+    do                                                                         \
+    {                                                                          \
+        if constexpr (detail::simd::HAS_KERNELS<T>)                            \
+        {                                                                      \
+            VECTOR_SIMD_DISPATCH_KERNELS(call)                                 \
+        }                                                                      \
+        return detail::simd::scalar::call;                                     \
+    } while (false)
+
+#if defined(VECTOR_SIMD_X86)
+#define VECTOR_SIMD_DISPATCH_KERNELS(call)                                     \
+    switch (ActiveSimdLevel())                                                 \
+    {                                                                          \
+    case SimdLevel::Avx512:                                                    \
+        return detail::simd::avx512::call;                                     \
+    case SimdLevel::Avx2:                                                      \
+        return detail::simd::avx2::call;                                       \
+    default:                                                                   \
+        break;                                                                 \
+    }
+#elif defined(VECTOR_SIMD_NEON)
+#define VECTOR_SIMD_DISPATCH_KERNELS(call)                                     \
+    if (ActiveSimdLevel() == SimdLevel::Neon)                                  \
+    {                                                                          \
+        return detail::simd::neon::call;                                       \
+    }
+#else
+#define VECTOR_SIMD_DISPATCH_KERNELS(call)
+#endif
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline void Fill(T* data, size_t n, std::type_identity_t<T> value) noexcept
+{
+    VECTOR_SIMD_DISPATCH(T, Fill(data, n, value));
+}
+
+//   ,  value,  n
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline size_t Find(const T* data, size_t n, std::type_identity_t<T> value) noexcept
+{
+    VECTOR_SIMD_DISPATCH(T, Find(data, n, value));
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline size_t Count(const T* data, size_t n, std::type_identity_t<T> value) noexcept
+{
+    VECTOR_SIMD_DISPATCH(T, Count(data, n, value));
+}
+
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline SumType<T> Sum(const T* data, size_t n) noexcept
+{
+    VECTOR_SIMD_DISPATCH(T, Sum(data, n));
+}
+
+//      
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline std::pair<T, T> MinMax(const T* data, size_t n) noexcept
+{
+    VECTOR_SIMD_DISPATCH(T, MinMax(data, n));
+}
+
+//  operation(input[i])  output[i].      ,
+//   operation  
+template <typename T, typename U, typename Operation>
+    requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U>
+inline void Transform(const T* input, size_t n, U* output, Operation operation)
+{
+    VECTOR_SIMD_DISPATCH(T, Transform(input, n, output, operation));
+}
+
+#undef VECTOR_SIMD_DISPATCH_KERNELS
+#undef VECTOR_SIMD_DISPATCH
+
+//   Vector, SmallVector      
+
+template <detail::simd::ArithmeticRange Range>
+inline void Fill(Range& range, detail::simd::RangeValue<Range> value) noexcept
+{
+    Fill(detail::simd::RangeData(range), detail::simd::RangeSize(range), value);
+}
+
+template <detail::simd::ArithmeticRange Range>
+inline auto Find(Range& range, detail::simd::RangeValue<Range> value) noexcept
+{
+    return std::begin(range) + Find(detail::simd::RangeData(range), detail::simd::RangeSize(range), value);
+}
+
+template <detail::simd::ArithmeticRange Range>
+inline size_t Count(const Range& range, detail::simd::RangeValue<Range> value) noexcept
+{
+    return Count(detail::simd::RangeData(range), detail::simd::RangeSize(range), value);
+}
+
+template <detail::simd::ArithmeticRange Range>
+inline SumType<detail::simd::RangeValue<Range>> Sum(const Range& range) noexcept
+{
+    return Sum(detail::simd::RangeData(range), detail::simd::RangeSize(range));
+}
+
+template <detail::simd::ArithmeticRange Range>
+inline std::pair<detail::simd::RangeValue<Range>, detail::simd::RangeValue<Range>> MinMax(const Range& range) noexcept
+{
+    return MinMax(detail::simd::RangeData(range), detail::simd::RangeSize(range));
+}
+
+//  output      input
+template <detail::simd::ArithmeticRange InputRange, detail::simd::ArithmeticRange OutputRange, typename Operation>
+inline void Transform(const InputRange& input, OutputRange& output, Operation operation)
+{
+    assert(detail::simd::RangeSize(output) >= detail::simd::RangeSize(input));
+    Transform(detail::simd::RangeData(input), detail::simd::RangeSize(input), detail::simd::RangeData(output),
+        std::move(operation));
+}
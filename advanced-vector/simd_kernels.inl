@@ -0,0 +1,190 @@
+//   simd_algorithms.h.    :     
+//    ,      target. Ops<T>  
+//  : WIDTH ,  Load/Store, Set1, Min, Max, EqMask ( 
+// ),     Acc  Zero, Accumulate  StoreAcc (ACC_WIDTH  SumType<T>)
+
+//    ,    .  alignof(T) < sizeof(T)
+// (int64_t  double  i386),      :  
+//  ,   n   
+template <typename T>
+inline size_t HeadSize(const T* data, size_t n) noexcept
+{
+    static_assert(sizeof(T) % alignof(T) == 0);
+    constexpr size_t REG_BYTES = Ops<T>::WIDTH * sizeof(T);
+    const auto address = reinterpret_cast<std::uintptr_t>(data);
+    const size_t gap = (REG_BYTES - address % REG_BYTES) % REG_BYTES;
+    if (gap % sizeof(T) != 0)
+    {
+        return n;
+    }
+    return std::min(n, gap / sizeof(T));
+}
+
+template <typename T>
+inline void Fill(T* data, size_t n, T value) noexcept
+{
+    using O = Ops<T>;
+    const size_t head = HeadSize(data, n);
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        data[i] = value;
+    }
+    const typename O::Reg reg = O::Set1(value);
+    for (; i + O::WIDTH <= n; i += O::WIDTH)
+    {
+        O::Store(data + i, reg);
+    }
+    for (; i < n; ++i)
+    {
+        data[i] = value;
+    }
+}
+
+template <typename T>
+inline size_t Find(const T* data, size_t n, T value) noexcept
+{
+    using O = Ops<T>;
+    const size_t head = HeadSize(data, n);
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    const typename O::Reg needle = O::Set1(value);
+    for (; i + O::WIDTH <= n; i += O::WIDTH)
+    {
+        if (const uint64_t mask = O::EqMask(O::Load(data + i), needle); mask != 0)
+        {
+            return i + std::countr_zero(mask);
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if (data[i] == value)
+        {
+            return i;
+        }
+    }
+    return n;
+}
+
+template <typename T>
+inline size_t Count(const T* data, size_t n, T value) noexcept
+{
+    using O = Ops<T>;
+    const size_t head = HeadSize(data, n);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        count += data[i] == value;
+    }
+    const typename O::Reg needle = O::Set1(value);
+    for (; i + O::WIDTH <= n; i += O::WIDTH)
+    {
+        count += std::popcount(O::EqMask(O::Load(data + i), needle));
+    }
+    for (; i < n; ++i)
+    {
+        count += data[i] == value;
+    }
+    return count;
+}
+
+template <typename T>
+inline SumType<T> Sum(const T* data, size_t n) noexcept
+{
+    using O = Ops<T>;
+    const size_t head = HeadSize(data, n);
+    SumType<T> sum = 0;
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        sum += data[i];
+    }
+    //      
+    typename O::Acc acc[4] = { O::Zero(), O::Zero(), O::Zero(), O::Zero() };
+    for (; i + 4 * O::WIDTH <= n; i += 4 * O::WIDTH)
+    {
+        for (size_t k = 0; k < 4; ++k)
+        {
+            acc[k] = O::Accumulate(acc[k], O::Load(data + i + k * O::WIDTH));
+        }
+    }
+    for (; i + O::WIDTH <= n; i += O::WIDTH)
+    {
+        acc[0] = O::Accumulate(acc[0], O::Load(data + i));
+    }
+    for (; i < n; ++i)
+    {
+        sum += data[i];
+    }
+    SumType<T> lanes[O::ACC_WIDTH];
+    for (const typename O::Acc& a : acc)
+    {
+        O::StoreAcc(lanes, a);
+        for (SumType<T> lane : lanes)
+        {
+            sum += lane;
+        }
+    }
+    return sum;
+}
+
+template <typename T>
+inline std::pair<T, T> MinMax(const T* data, size_t n) noexcept
+{
+    using O = Ops<T>;
+    assert(n != 0);
+    const size_t head = HeadSize(data, n);
+    T min = data[0];
+    T max = data[0];
+    size_t i = 0;
+    for (; i < head; ++i)
+    {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+    }
+    if (i + O::WIDTH <= n)
+    {
+        typename O::Reg min_reg = O::Set1(min);
+        typename O::Reg max_reg = O::Set1(max);
+        for (; i + O::WIDTH <= n; i += O::WIDTH)
+        {
+            const typename O::Reg reg = O::Load(data + i);
+            min_reg = O::Min(min_reg, reg);
+            max_reg = O::Max(max_reg, reg);
+        }
+        alignas(64) T lanes[O::WIDTH];
+        O::Store(lanes, min_reg);
+        for (T lane : lanes)
+        {
+            min = std::min(min, lane);
+        }
+        O::Store(lanes, max_reg);
+        for (T lane : lanes)
+        {
+            max = std::max(max, lane);
+        }
+    }
+    for (; i < n; ++i)
+    {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+    }
+    return { min, max };
+}
+
+//         
+template <typename T, typename U, typename Operation>
+inline void Transform(const T* input, size_t n, U* output, Operation& operation)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        output[i] = operation(input[i]);
+    }
+}
@@ -0,0 +1,435 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+//     N   .     ,
+//   ;      RawMemory
+template <typename T, size_t N, typename Allocator = std::allocator<T>, typename GrowthPolicy = DoublingGrowth>
+class SmallVector
+{
+    static_assert(N > 0, "Use Vector for containers without inline storage");
+
+public:
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+private:
+    using AllocTraits = std::allocator_traits<allocator_type>;
+
+public:
+    static constexpr size_t INLINE_CAPACITY = N;
+
+    SmallVector() = default;
+
+    explicit SmallVector(const allocator_type& alloc) noexcept;
+
+    explicit SmallVector(size_t size, const allocator_type& alloc = allocator_type());
+
+    SmallVector(const SmallVector& other);
+
+    SmallVector(const SmallVector& other, const allocator_type& alloc);
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    //     propagate_on_container_copy_assignment 
+    // propagate_on_container_move_assignment,   Vector.       ,
+    //      
+    SmallVector& operator=(const SmallVector& rhs);
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>
+        && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value));
+
+    ~SmallVector();
+
+    iterator begin() noexcept
+    {
+        return Data();
+    }
+    iterator end() noexcept
+    {
+        return Data() + size_;
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_cast<SmallVector&>(*this).Data();
+    }
+    const_iterator cend() const noexcept
+    {
+        return cbegin() + size_;
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+    size_t Capacity() const noexcept
+    {
+        return IsInline() ? N : heap_.Capacity();
+    }
+    //     
+    bool IsInline() const noexcept
+    {
+        return heap_.GetAddress() == nullptr;
+    }
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<SmallVector&>(*this)[index];
+    }
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return Data()[index];
+    }
+    const allocator_type& GetAllocator() const noexcept
+    {
+        return heap_.GetAllocator();
+    }
+
+    void Reserve(size_t new_capacity);
+    void Resize(size_t new_size);
+    //     ,       ,
+    //          
+    void Swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T>
+        && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value));
+
+    template <typename V>
+    void PushBack(V&& value);
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args);
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args);
+
+    template <typename V>
+    iterator Insert(const_iterator pos, V&& value)
+    {
+        return Emplace(pos, std::forward<V>(value));
+    }
+
+    void PopBack() noexcept;
+    T& Back() noexcept;
+    iterator Erase(const_iterator pos);
+
+private:
+    T* Data() noexcept
+    {
+        return IsInline() ? reinterpret_cast<T*>(inline_) : heap_.GetAddress();
+    }
+
+    //       
+    void Reset() noexcept;
+
+    //  ,      alloc,     .
+    //  ,  propagate_on_container_copy_assignment 
+    // propagate_on_container_move_assignment   rhs
+    void Reset(const allocator_type& alloc) noexcept
+    {
+        std::destroy_n(Data(), size_);
+        size_ = 0;
+        heap_.Replace(RawMemory<T, Allocator>(alloc));
+    }
+
+    //   other:    -  (   ),
+    //    - 
+    void Steal(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    //      new_capacity       pos
+    template <typename... Args>
+    T* GrowAndEmplace(size_t pos, size_t new_capacity, Args&&... args);
+
+    RawMemory<T, Allocator> heap_;
+    size_t size_ = 0;
+    alignas(T) std::byte inline_[N * sizeof(T)];
+};
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(const allocator_type& alloc) noexcept
+    : heap_(alloc)
+{
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(size_t size, const allocator_type& alloc)
+    : heap_(size > N ? size : 0, alloc)
+{
+    std::uninitialized_value_construct_n(Data(), size);
+    size_ = size;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(const SmallVector& other)
+    : SmallVector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator()))
+{
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(const SmallVector& other, const allocator_type& alloc)
+    : heap_(other.size_ > N ? other.size_ : 0, alloc)
+{
+    std::uninitialized_copy_n(other.begin(), other.size_, Data());
+    size_ = other.size_;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::SmallVector(SmallVector&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+    : heap_(other.GetAllocator())
+{
+    Steal(other);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>& SmallVector<T, N, Allocator, GrowthPolicy>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs)
+    {
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value
+            && !AllocTraits::is_always_equal::value)
+        {
+            if (GetAllocator() != rhs.GetAllocator())
+            {
+                SmallVector rhs_copy(rhs, rhs.GetAllocator());
+                Reset(rhs.GetAllocator());
+                Steal(rhs_copy);
+                return *this;
+            }
+        }
+        if (rhs.size_ > Capacity())
+        {
+            SmallVector rhs_copy(rhs, GetAllocator());
+            Swap(rhs_copy);
+        }
+        else
+        {
+            const size_t common = std::min(size_, rhs.size_);
+            std::copy_n(rhs.begin(), common, begin());
+            if (rhs.size_ < size_)
+            {
+                std::destroy_n(begin() + rhs.size_, size_ - rhs.size_);
+            }
+            else
+            {
+                std::uninitialized_copy_n(rhs.begin() + size_, rhs.size_ - size_, begin() + size_);
+            }
+            size_ = rhs.size_;
+        }
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>& SmallVector<T, N, Allocator, GrowthPolicy>::operator=(SmallVector&& rhs)
+    noexcept(std::is_nothrow_move_constructible_v<T>
+        && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value))
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+    {
+        //  rhs   ,       
+        Reset(rhs.GetAllocator());
+    }
+    else
+    {
+        if constexpr (!AllocTraits::is_always_equal::value)
+        {
+            //    :          
+            if (!rhs.IsInline() && GetAllocator() != rhs.GetAllocator())
+            {
+                RawMemory<T, Allocator> new_data(rhs.size_ > N ? rhs.size_ : 0, GetAllocator());
+                Reset();
+                heap_.Swap(new_data);
+                detail::RelocateWithGap(rhs.Data(), rhs.size_, Data(), rhs.size_);
+                size_ = std::exchange(rhs.size_, 0);
+                return *this;
+            }
+        }
+        Reset();
+    }
+    Steal(rhs);
+    return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline SmallVector<T, N, Allocator, GrowthPolicy>::~SmallVector()
+{
+    std::destroy_n(Data(), size_);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::Reset() noexcept
+{
+    std::destroy_n(Data(), size_);
+    size_ = 0;
+    RawMemory<T, Allocator> released(GetAllocator());
+    heap_.Swap(released);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::Steal(SmallVector& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    assert(size_ == 0 && IsInline());
+    if (other.IsInline())
+    {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            detail::RelocateBytes(Data(), other.Data(), other.size_);
+        }
+        else
+        {
+            std::uninitialized_move_n(other.Data(), other.size_, Data());
+            std::destroy_n(other.Data(), other.size_);
+        }
+    }
+    else
+    {
+        heap_.Swap(other.heap_);
+    }
+    size_ = std::exchange(other.size_, 0);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::Swap(SmallVector& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>
+        && (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value))
+{
+    if (!IsInline() && !other.IsInline()
+        && (AllocTraits::propagate_on_container_swap::value || GetAllocator() == other.GetAllocator()))
+    {
+        heap_.Swap(other.heap_);
+        std::swap(size_, other.size_);
+        return;
+    }
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::Reserve(size_t new_capacity)
+{
+    if (new_capacity <= Capacity())
+    {
+        return;
+    }
+    RawMemory<T, Allocator> new_data(new_capacity, GetAllocator());
+    detail::RelocateWithGap(Data(), size_, new_data.GetAddress(), size_);
+    heap_.Swap(new_data);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::Resize(size_t new_size)
+{
+    if (new_size <= size_)
+    {
+        std::destroy_n(Data() + new_size, size_ - new_size);
+    }
+    else
+    {
+        Reserve(new_size);
+        std::uninitialized_value_construct_n(Data() + size_, new_size - size_);
+    }
+    size_ = new_size;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <typename V>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::PushBack(V&& value)
+{
+    EmplaceBack(std::forward<V>(value));
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+inline T& SmallVector<T, N, Allocator, GrowthPolicy>::EmplaceBack(Args&&... args)
+{
+    if (size_ == Capacity())
+    {
+        return *GrowAndEmplace(size_, GrowthPolicy::template NextCapacity<T>(Capacity(), size_ + 1),
+            std::forward<Args>(args)...);
+    }
+    new (Data() + size_) T(std::forward<Args>(args)...);
+    ++size_;
+    return Back();
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+inline typename SmallVector<T, N, Allocator, GrowthPolicy>::iterator
+SmallVector<T, N, Allocator, GrowthPolicy>::Emplace(const_iterator pos, Args&&... args)
+{
+    assert(pos >= begin() && pos <= end());
+    const size_t pos_t = pos - begin();
+    if (size_ == Capacity())
+    {
+        return GrowAndEmplace(pos_t, GrowthPolicy::template NextCapacity<T>(Capacity(), size_ + 1),
+            std::forward<Args>(args)...);
+    }
+    if (pos_t == size_)
+    {
+        return &EmplaceBack(std::forward<Args>(args)...);
+    }
+    T* data = Data();
+    detail::ShiftInsert(data + pos_t, data + size_, data + size_, std::forward<Args>(args)...);
+    ++size_;
+    return data + pos_t;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+inline T* SmallVector<T, N, Allocator, GrowthPolicy>::GrowAndEmplace(size_t pos, size_t new_capacity, Args&&... args)
+{
+    RawMemory<T, Allocator> new_data(std::max(new_capacity, size_ + 1), GetAllocator());
+    new (new_data + pos) T(std::forward<Args>(args)...);
+    try
+    {
+        detail::RelocateWithGap(Data(), size_, new_data.GetAddress(), pos);
+    }
+    catch (...)
+    {
+        (new_data + pos)->~T();
+        throw;
+    }
+    heap_.Swap(new_data);
+    ++size_;
+    return Data() + pos;
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline void SmallVector<T, N, Allocator, GrowthPolicy>::PopBack() noexcept
+{
+    assert(size_ > 0);
+    --size_;
+    std::destroy_at(Data() + size_);
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline T& SmallVector<T, N, Allocator, GrowthPolicy>::Back() noexcept
+{
+    assert(size_ > 0);
+    return Data()[size_ - 1];
+}
+
+template <typename T, size_t N, typename Allocator, typename GrowthPolicy>
+inline typename SmallVector<T, N, Allocator, GrowthPolicy>::iterator
+SmallVector<T, N, Allocator, GrowthPolicy>::Erase(const_iterator pos)
+{
+    assert(pos >= begin() && pos < end());
+    const size_t pos_t = pos - begin();
+    T* data = Data();
+    std::move(data + pos_t + 1, data + size_, data + pos_t);
+    PopBack();
+    return data + pos_t;
+}
@@ -0,0 +1,397 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//  ,       RawMemory ( ).
+// ,  - ,           .
+//           GrowthPolicy.
+//     std::tuple<Fields&...>,    .
+//     Vector:     , Erase - 
+template <typename GrowthPolicy, typename... Fields>
+class BasicSoAVector
+{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+    using Indices = std::index_sequence_for<Fields...>;
+
+public:
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using iterator = detail::IndexIterator<BasicSoAVector, reference>;
+    using const_iterator = detail::IndexIterator<const BasicSoAVector, const_reference>;
+
+    static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+
+    BasicSoAVector() = default;
+
+    explicit BasicSoAVector(size_t size)
+    {
+        Resize(size);
+    }
+
+    BasicSoAVector(const BasicSoAVector& other)
+        : columns_(RawMemory<Fields>(other.size_)...)
+    {
+        CopyRows(other, Indices{});
+    }
+
+    BasicSoAVector(BasicSoAVector&& other) noexcept
+        : columns_(std::move(other.columns_))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    BasicSoAVector& operator=(const BasicSoAVector& rhs)
+    {
+        if (this != &rhs)
+        {
+            BasicSoAVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    BasicSoAVector& operator=(BasicSoAVector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            BasicSoAVector moved(std::move(rhs));
+            Swap(moved);
+        }
+        return *this;
+    }
+
+    ~BasicSoAVector()
+    {
+        DestroyRows(0, size_, Indices{});
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+    size_t Capacity() const noexcept
+    {
+        return std::get<0>(columns_).Capacity();
+    }
+
+    reference operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return Row(index, Indices{});
+    }
+    const_reference operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return const_cast<BasicSoAVector&>(*this).Row(index, Indices{});
+    }
+
+    //   I
+    template <size_t I>
+    std::span<FieldType<I>> Column() noexcept
+    {
+        return { std::get<I>(columns_).GetAddress(), size_ };
+    }
+    template <size_t I>
+    std::span<const FieldType<I>> Column() const noexcept
+    {
+        return { std::get<I>(columns_).GetAddress(), size_ };
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity > Capacity())
+        {
+            Reallocate(new_capacity, Indices{});
+        }
+    }
+
+    //      
+    void ShrinkToFit()
+    {
+        if (size_ < Capacity())
+        {
+            Reallocate(size_, Indices{});
+        }
+    }
+
+    //      
+    void Resize(size_t new_size)
+    {
+        if (new_size <= size_)
+        {
+            DestroyRows(new_size, size_, Indices{});
+            size_ = new_size;
+            return;
+        }
+        Reserve(new_size);
+        const size_t old_size = size_;
+        try
+        {
+            for (; size_ < new_size; ++size_)
+            {
+                ConstructRow(size_, std::tuple<>{}, Indices{});
+            }
+        }
+        catch (...)
+        {
+            DestroyRows(old_size, size_, Indices{});
+            size_ = old_size;
+            throw;
+        }
+    }
+
+    //  : i-    i- 
+    template <typename... Args>
+        requires(sizeof...(Args) == sizeof...(Fields))
+    reference EmplaceBack(Args&&... args)
+    {
+        if (size_ == Capacity())
+        {
+            //     ,      
+            value_type row(std::forward<Args>(args)...);
+            Reallocate(GrowthPolicy::template NextCapacity<value_type>(Capacity(), size_ + 1), Indices{});
+            ConstructRow(size_, std::move(row), Indices{});
+        }
+        else
+        {
+            ConstructRow(size_, std::forward_as_tuple(std::forward<Args>(args)...), Indices{});
+        }
+        ++size_;
+        return (*this)[size_ - 1];
+    }
+
+    void PushBack(const value_type& row)
+    {
+        std::apply([this](const Fields&... fields) { EmplaceBack(fields...); }, row);
+    }
+
+    void PushBack(value_type&& row)
+    {
+        std::apply([this](Fields&... fields) { EmplaceBack(std::move(fields)...); }, row);
+    }
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        --size_;
+        DestroyRows(size_, size_ + 1, Indices{});
+    }
+
+    void Clear() noexcept
+    {
+        DestroyRows(0, size_, Indices{});
+        size_ = 0;
+    }
+
+    //    index     
+    iterator Erase(size_t index)
+    {
+        assert(index < size_);
+        return Erase(index, index + 1);
+    }
+
+    iterator Erase(size_t first, size_t last)
+    {
+        assert(first <= last && last <= size_);
+        ShiftDown(first, last, Indices{});
+        DestroyRows(size_ - (last - first), size_, Indices{});
+        size_ -= last - first;
+        return iterator(this, first);
+    }
+
+    iterator Erase(const_iterator pos)
+    {
+        return Erase(pos.Index());
+    }
+
+    void Swap(BasicSoAVector& other) noexcept
+    {
+        SwapColumns(other, Indices{});
+        std::swap(size_, other.size_);
+    }
+
+private:
+    using Columns = std::tuple<RawMemory<Fields>...>;
+
+    template <size_t... I>
+    reference Row(size_t index, std::index_sequence<I...>) noexcept
+    {
+        return reference(std::get<I>(columns_)[index]...);
+    }
+
+    //   row    args (  -  )
+    template <typename Tuple, size_t... I>
+    void ConstructRow(size_t row, Tuple&& args, std::index_sequence<I...>)
+    {
+        size_t built = 0;
+        try
+        {
+            if constexpr (std::tuple_size_v<std::remove_reference_t<Tuple>> == 0)
+            {
+                ((new (std::get<I>(columns_) + row) Fields(), ++built), ...);
+            }
+            else
+            {
+                ((new (std::get<I>(columns_) + row) Fields(std::get<I>(std::forward<Tuple>(args))), ++built), ...);
+            }
+        }
+        catch (...)
+        {
+            ((I < built ? std::destroy_at(std::get<I>(columns_) + row) : void()), ...);
+            throw;
+        }
+    }
+
+    template <size_t... I>
+    void DestroyRows(size_t first, size_t last, std::index_sequence<I...>) noexcept
+    {
+        (std::destroy(std::get<I>(columns_) + first, std::get<I>(columns_) + last), ...);
+    }
+
+    template <size_t... I>
+    void ShiftDown(size_t first, size_t last, std::index_sequence<I...>)
+    {
+        (std::move(std::get<I>(columns_) + last, std::get<I>(columns_) + size_, std::get<I>(columns_) + first), ...);
+    }
+
+    template <size_t... I>
+    void SwapColumns(BasicSoAVector& other, std::index_sequence<I...>) noexcept
+    {
+        (std::get<I>(columns_).Swap(std::get<I>(other.columns_)), ...);
+    }
+
+    template <size_t... I>
+    void CopyRows(const BasicSoAVector& other, std::index_sequence<I...>)
+    {
+        size_t copied = 0;
+        try
+        {
+            ((std::uninitialized_copy_n(std::get<I>(other.columns_).GetAddress(), other.size_,
+                 std::get<I>(columns_).GetAddress()), ++copied), ...);
+        }
+        catch (...)
+        {
+            ((I < copied ? std::destroy_n(std::get<I>(columns_).GetAddress(), other.size_) : nullptr), ...);
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    //       new_capacity.   , 
+    //   ,   - :      .
+    //        
+    template <size_t... I>
+    void Reallocate(size_t new_capacity, std::index_sequence<I...>)
+    {
+        assert(new_capacity >= size_);
+        Columns new_columns{ RawMemory<Fields>(new_capacity)... };
+        size_t transferred = 0;
+        try
+        {
+            (TransferThrowingColumn<I>(new_columns, transferred), ...);
+        }
+        catch (...)
+        {
+            (DestroyTransferredColumn<I>(new_columns, transferred), ...);
+            throw;
+        }
+        (FinishColumn<I>(new_columns), ...);
+        columns_.swap(new_columns);
+    }
+
+    template <typename F>
+    static constexpr bool MAY_THROW_ON_RELOCATE = !IS_TRIVIALLY_RELOCATABLE<F> && !std::is_nothrow_move_constructible_v<F>;
+
+    template <size_t I>
+    void TransferThrowingColumn(Columns& new_columns, size_t& transferred)
+    {
+        using F = FieldType<I>;
+        if constexpr (MAY_THROW_ON_RELOCATE<F>)
+        {
+            F* from = std::get<I>(columns_).GetAddress();
+            F* to = std::get<I>(new_columns).GetAddress();
+            if constexpr (std::is_copy_constructible_v<F>)
+            {
+                std::uninitialized_copy_n(from, size_, to);
+            }
+            else
+            {
+                std::uninitialized_move_n(from, size_, to);
+            }
+            ++transferred;
+        }
+    }
+
+    template <size_t I>
+    void DestroyTransferredColumn(Columns& new_columns, size_t& transferred) noexcept
+    {
+        if constexpr (MAY_THROW_ON_RELOCATE<FieldType<I>>)
+        {
+            if (transferred != 0)
+            {
+                --transferred;
+                std::destroy_n(std::get<I>(new_columns).GetAddress(), size_);
+            }
+        }
+    }
+
+    template <size_t I>
+    void FinishColumn(Columns& new_columns) noexcept
+    {
+        FieldType<I>* from = std::get<I>(columns_).GetAddress();
+        if constexpr (MAY_THROW_ON_RELOCATE<FieldType<I>>)
+        {
+            std::destroy_n(from, size_);
+        }
+        else
+        {
+            detail::RelocateWithGap(from, size_, std::get<I>(new_columns).GetAddress(), size_, 0);
+        }
+    }
+
+    Columns columns_;
+    size_t size_ = 0;
+};
+
+template <typename... Fields>
+using SoAVector = BasicSoAVector<DoublingGrowth, Fields...>;
@@ -0,0 +1,471 @@
+#pragma once
+#include "vector.h"
+#include "container_detail.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace detail
+{
+
+//   N   .      
+//     
+template <typename T, size_t N, bool = std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>>
+struct StaticStorage
+{
+    constexpr StaticStorage() noexcept {}
+    constexpr ~StaticStorage() {}
+
+    union
+    {
+        T data[N];
+    };
+};
+
+//      .     ,
+//          : 
+// constexpr-     
+template <typename T, size_t N>
+struct StaticStorage<T, N, true>
+{
+    constexpr StaticStorage() noexcept
+    {
+        if (std::is_constant_evaluated())
+        {
+            for (T& elem : data)
+            {
+                std::construct_at(std::addressof(elem));
+            }
+        }
+    }
+
+    T data[N];
+};
+
+} // namespace detail
+
+//    N    .    ;
+//     std::length_error,      .
+//    ,   Vector.   constexpr,   
+//   ,     
+template <typename T, size_t N>
+class StaticVector
+{
+    static_assert(N > 0, "StaticVector needs a non-zero capacity");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t CAPACITY = N;
+
+    constexpr StaticVector() noexcept = default;
+
+    constexpr explicit StaticVector(size_t size);
+
+    constexpr StaticVector(size_t size, const T& value);
+
+    constexpr StaticVector(std::initializer_list<T> init);
+
+    constexpr StaticVector(const StaticVector& other);
+
+    constexpr StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    constexpr StaticVector& operator=(const StaticVector& rhs);
+    constexpr StaticVector& operator=(StaticVector&& rhs) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+
+    constexpr ~StaticVector()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+
+    constexpr ~StaticVector()
+    {
+        std::destroy_n(Data(), size_);
+    }
+
+    constexpr iterator begin() noexcept
+    {
+        return Data();
+    }
+    constexpr iterator end() noexcept
+    {
+        return Data() + size_;
+    }
+    constexpr const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    constexpr const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return storage_.data;
+    }
+    constexpr const_iterator cend() const noexcept
+    {
+        return cbegin() + size_;
+    }
+
+    constexpr size_t Size() const noexcept
+    {
+        return size_;
+    }
+    constexpr size_t Capacity() const noexcept
+    {
+        return N;
+    }
+    constexpr bool IsFull() const noexcept
+    {
+        return size_ == N;
+    }
+    constexpr const T& operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return storage_.data[index];
+    }
+    constexpr T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return storage_.data[index];
+    }
+
+    //   : ,  new_capacity  
+    constexpr void Reserve(size_t new_capacity) const
+    {
+        CheckCapacity(new_capacity);
+    }
+
+    constexpr void Resize(size_t new_size);
+    constexpr void Clear() noexcept;
+    constexpr void Swap(StaticVector& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
+
+    template <typename V>
+    constexpr void PushBack(V&& value);
+
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args);
+
+    template <typename... Args>
+    constexpr iterator Emplace(const_iterator pos, Args&&... args);
+
+    template <typename V>
+    constexpr iterator Insert(const_iterator pos, V&& value)
+    {
+        return Emplace(pos, std::forward<V>(value));
+    }
+
+    //    ,  std::length_error     
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    constexpr iterator Insert(const_iterator pos, InputIt first, InputIt last);
+
+    template <typename Range>
+    constexpr void Append(const Range& range)
+    {
+        Insert(cend(), std::begin(range), std::end(range));
+    }
+
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    constexpr void Assign(InputIt first, InputIt last);
+
+    constexpr iterator Erase(const_iterator pos)
+    {
+        return Erase(pos, pos + 1);
+    }
+
+    constexpr iterator Erase(const_iterator first, const_iterator last);
+
+    template <typename Predicate>
+    constexpr size_t EraseIf(Predicate pred);
+
+    constexpr iterator UnorderedErase(const_iterator pos);
+
+    constexpr void PopBack() noexcept;
+    constexpr T& Back() noexcept;
+
+private:
+    constexpr T* Data() noexcept
+    {
+        return storage_.data;
+    }
+
+    static constexpr void CheckCapacity(size_t size)
+    {
+        if (size > N)
+        {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+    }
+
+    //      new_size
+    constexpr void TruncateTo(size_t new_size) noexcept;
+
+    detail::StaticStorage<T, N> storage_;
+    size_t size_ = 0;
+};
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(size_t size)
+{
+    CheckCapacity(size);
+    Resize(size);
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(size_t size, const T& value)
+{
+    Insert(cend(), detail::RepeatIterator<T>(value, 0), detail::RepeatIterator<T>(value, size));
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(std::initializer_list<T> init)
+{
+    Insert(cend(), init.begin(), init.end());
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(const StaticVector& other)
+{
+    Insert(cend(), other.begin(), other.end());
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>::StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    Insert(cend(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::operator=(const StaticVector& rhs)
+{
+    if (this != &rhs)
+    {
+        const size_t common = std::min(size_, rhs.size_);
+        std::copy_n(rhs.begin(), common, begin());
+        TruncateTo(rhs.size_);
+        for (size_t i = size_; i < rhs.size_; ++i)
+        {
+            EmplaceBack(rhs[i]);
+        }
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr StaticVector<T, N>& StaticVector<T, N>::operator=(StaticVector&& rhs) noexcept(
+    std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+{
+    if (this != &rhs)
+    {
+        const size_t common = std::min(size_, rhs.size_);
+        std::move(rhs.begin(), rhs.begin() + common, begin());
+        TruncateTo(rhs.size_);
+        for (size_t i = size_; i < rhs.size_; ++i)
+        {
+            EmplaceBack(std::move(rhs[i]));
+        }
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::TruncateTo(size_t new_size) noexcept
+{
+    if (new_size < size_)
+    {
+        //      ,   constexpr-
+        //    
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            std::destroy(Data() + new_size, Data() + size_);
+        }
+        size_ = new_size;
+    }
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::Resize(size_t new_size)
+{
+    CheckCapacity(new_size);
+    const size_t old_size = size_;
+    try
+    {
+        while (size_ < new_size)
+        {
+            detail::ForwardConstruct(Data() + size_);
+            ++size_;
+        }
+    }
+    catch (...)
+    {
+        TruncateTo(old_size);
+        throw;
+    }
+    TruncateTo(new_size);
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::Clear() noexcept
+{
+    TruncateTo(0);
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::Swap(StaticVector& other) noexcept(
+    std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>)
+{
+    StaticVector& shorter = size_ < other.size_ ? *this : other;
+    StaticVector& longer = size_ < other.size_ ? other : *this;
+    const size_t common = shorter.size_;
+    std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+    for (size_t i = common; i < longer.size_; ++i)
+    {
+        shorter.EmplaceBack(std::move(longer[i]));
+    }
+    longer.TruncateTo(common);
+}
+
+template <typename T, size_t N>
+template <typename V>
+constexpr void StaticVector<T, N>::PushBack(V&& value)
+{
+    EmplaceBack(std::forward<V>(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr T& StaticVector<T, N>::EmplaceBack(Args&&... args)
+{
+    CheckCapacity(size_ + 1);
+    T* slot = detail::ForwardConstruct(Data() + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr typename StaticVector<T, N>::iterator StaticVector<T, N>::Emplace(const_iterator pos, Args&&... args)
+{
+    assert(cbegin() <= pos && pos <= cend());
+    const size_t pos_t = pos - cbegin();
+    if (pos_t == size_)
+    {
+        return std::addressof(EmplaceBack(std::forward<Args>(args)...));
+    }
+    CheckCapacity(size_ + 1);
+    T* data = Data();
+    detail::ShiftInsert(data + pos_t, data + size_, data + size_, std::forward<Args>(args)...);
+    ++size_;
+    return data + pos_t;
+}
+
+template <typename T, size_t N>
+template <typename InputIt>
+    requires std::input_iterator<InputIt>
+constexpr typename StaticVector<T, N>::iterator StaticVector<T, N>::Insert(const_iterator pos, InputIt first, InputIt last)
+{
+    assert(cbegin() <= pos && pos <= cend());
+    const size_t pos_t = pos - cbegin();
+    const size_t old_size = size_;
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        CheckCapacity(size_ + static_cast<size_t>(std::distance(first, last)));
+    }
+    //          
+    try
+    {
+        for (; first != last; ++first)
+        {
+            EmplaceBack(*first);
+        }
+    }
+    catch (...)
+    {
+        TruncateTo(old_size);
+        throw;
+    }
+    std::rotate(Data() + pos_t, Data() + old_size, Data() + size_);
+    return Data() + pos_t;
+}
+
+template <typename T, size_t N>
+template <typename InputIt>
+    requires std::input_iterator<InputIt>
+constexpr void StaticVector<T, N>::Assign(InputIt first, InputIt last)
+{
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        CheckCapacity(count);
+        const size_t common = std::min(size_, count);
+        InputIt mid = std::next(first, static_cast<std::ptrdiff_t>(common));
+        std::copy(first, mid, begin());
+        TruncateTo(count);
+        Insert(cend(), mid, last);
+    }
+    else
+    {
+        Clear();
+        Insert(cend(), first, last);
+    }
+}
+
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::iterator StaticVector<T, N>::Erase(const_iterator first, const_iterator last)
+{
+    assert(cbegin() <= first && first <= last && last <= cend());
+    const size_t pos = first - cbegin();
+    const size_t count = last - first;
+    std::move(Data() + pos + count, end(), Data() + pos);
+    TruncateTo(size_ - count);
+    return Data() + pos;
+}
+
+template <typename T, size_t N>
+template <typename Predicate>
+constexpr size_t StaticVector<T, N>::EraseIf(Predicate pred)
+{
+    const size_t old_size = size_;
+    T* kept = std::remove_if(begin(), end(), pred);
+    TruncateTo(kept - begin());
+    return old_size - size_;
+}
+
+template <typename T, size_t N>
+constexpr typename StaticVector<T, N>::iterator StaticVector<T, N>::UnorderedErase(const_iterator pos)
+{
+    assert(cbegin() <= pos && pos < cend());
+    const size_t pos_t = pos - cbegin();
+    if (pos_t != size_ - 1)
+    {
+        Data()[pos_t] = std::move(Back());
+    }
+    PopBack();
+    return Data() + pos_t;
+}
+
+template <typename T, size_t N>
+constexpr void StaticVector<T, N>::PopBack() noexcept
+{
+    assert(size_ > 0);
+    TruncateTo(size_ - 1);
+}
+
+template <typename T, size_t N>
+constexpr T& StaticVector<T, N>::Back() noexcept
+{
+    assert(size_ > 0);
+    return Data()[size_ - 1];
+}
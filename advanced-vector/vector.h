@@ -1,37 +1,223 @@
 #pragma once
+#include "container_detail.h"
+
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <cstddef>
+#include <exception>
 #include <new>
 #include <utility>
 #include <memory>
 #include <algorithm>
+#include <bit>
+#include <concepts>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+//  ,         ,
+//      .    (,
+//    unique_ptr)    
+template <typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T, typename Deleter>
+struct IsTriviallyRelocatable<std::unique_ptr<T, Deleter>> : IsTriviallyRelocatable<Deleter> {};
+
+template <typename T>
+inline constexpr bool IS_TRIVIALLY_RELOCATABLE = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+
+namespace detail {
+
+//        buf.       constexpr-
+template <typename T, typename... Args>
+constexpr T* ForwardConstruct(T* buf, Args&&... args)
+{
+    return std::construct_at(buf, std::forward<Args>(args)...);
+}
+
+//      buf
+template <typename T>
+constexpr void Destroy(T* buf) noexcept
+{
+    std::destroy_at(buf);
+}
+
+//   n   from  to.   
+template <typename T>
+inline void RelocateBytes(T* to, const T* from, size_t n) noexcept
+{
+    static_assert(IS_TRIVIALLY_RELOCATABLE<T>);
+    if (n != 0)
+    {
+        std::memmove(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(T));
+    }
+}
+
+//  n     memmove.   
+template <typename T>
+inline void CopyBytes(T* to, const T* from, size_t n) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (n != 0)
+    {
+        std::memmove(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(T));
+    }
+}
+
+//  size   from    to,   to
+// gap_size      gap ( gap == size  ).
+//   .    ,   
+template <typename T>
+void RelocateWithGap(T* from, size_t size, T* to, size_t gap, size_t gap_size = 1)
+{
+    assert(gap <= size);
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+    {
+        RelocateBytes(to, from, gap);
+        RelocateBytes(to + gap + gap_size, from + gap, size - gap);
+    }
+    else
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move_n(from, gap, to);
+            std::uninitialized_move_n(from + gap, size - gap, to + gap + gap_size);
+        }
+        else
+        {
+            std::uninitialized_copy_n(from, gap, to);
+            try
+            {
+                std::uninitialized_copy_n(from + gap, size - gap, to + gap + gap_size);
+            }
+            catch (...)
+            {
+                std::destroy_n(to, gap);
+                throw;
+            }
+        }
+        std::destroy_n(from, size);
+    }
+}
 
+//    count   ,   count  
 template <typename T>
+class RepeatIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    constexpr RepeatIterator() = default;
+    constexpr RepeatIterator(const T& value, size_t index) noexcept
+        : value_(&value)
+        , index_(index)
+    {
+    }
+
+    constexpr reference operator*() const noexcept
+    {
+        return *value_;
+    }
+    constexpr pointer operator->() const noexcept
+    {
+        return value_;
+    }
+    constexpr RepeatIterator& operator++() noexcept
+    {
+        ++index_;
+        return *this;
+    }
+    constexpr RepeatIterator operator++(int) noexcept
+    {
+        RepeatIterator old = *this;
+        ++index_;
+        return old;
+    }
+    constexpr bool operator==(const RepeatIterator& other) const noexcept
+    {
+        return index_ == other.index_;
+    }
+    constexpr bool operator!=(const RepeatIterator& other) const noexcept
+    {
+        return index_ != other.index_;
+    }
+
+private:
+    const T* value_ = nullptr;
+    size_t index_ = 0;
+};
+
+//      : bool expand(T* p, size_t old_n, size_t new_n)
+template <typename Alloc, typename T, typename = void>
+struct HasExpand : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasExpand<Alloc, T, std::void_t<decltype(bool(std::declval<Alloc&>().expand(
+    std::declval<T*>(), size_t{}, size_t{})))>> : std::true_type {};
+
+//         ( realloc):
+// T* reallocate(T* p, size_t old_n, size_t new_n)
+template <typename Alloc, typename T, typename = void>
+struct HasReallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasReallocate<Alloc, T, std::void_t<decltype(static_cast<T*>(std::declval<Alloc&>().reallocate(
+    std::declval<T*>(), size_t{}, size_t{})))>> : std::true_type {};
+
+}  // namespace detail
+
+//      T.     ,
+//   std::allocator_traits (   std::pmr::polymorphic_allocator)
+template <typename T, typename Allocator = std::allocator<T>>
 class RawMemory {
 public:
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+private:
+    using AllocTraits = std::allocator_traits<allocator_type>;
+    static_assert(std::is_same_v<typename AllocTraits::pointer, T*>, "Allocator must use raw pointers");
+
+public:
+    //     allocator.reallocate,   
+    static constexpr bool CAN_REALLOCATE = IS_TRIVIALLY_RELOCATABLE<T> && detail::HasReallocate<allocator_type, T>::value;
+
     RawMemory() = default;
     RawMemory(const RawMemory&) = delete;
     RawMemory& operator=(const RawMemory& rhs) = delete;
-    RawMemory(RawMemory&& other) noexcept 
+    RawMemory(RawMemory&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , buffer_(std::exchange(other.buffer_, nullptr))
+        , capacity_(std::exchange(other.capacity_, 0))
     {
-        if(buffer_)
-        {
-            Deallocate(buffer_);
-        }
-        Swap(other);
     }
     RawMemory& operator=(RawMemory&& rhs) noexcept 
     { 
         Swap(rhs);
         return *this;
     }
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
+    explicit RawMemory(const allocator_type& alloc) noexcept
+        : alloc_(alloc) {}
+
+    explicit RawMemory(size_t capacity, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc)
+        , buffer_(Allocate(capacity))
         , capacity_(capacity) {}
 
     ~RawMemory() 
     {
-        Deallocate(buffer_);
+        Deallocate(buffer_, capacity_);
     }
 
     T* operator+(size_t offset) noexcept 
@@ -57,12 +243,33 @@ public:
         return buffer_[index];
     }
 
+    //  ,     propagate_on_container_swap,
+    //     
     void Swap(RawMemory& other) noexcept 
     {
+        if constexpr (AllocTraits::propagate_on_container_swap::value)
+        {
+            std::swap(alloc_, other.alloc_);
+        }
+        else
+        {
+            assert(alloc_ == other.alloc_);
+        }
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
+    //       other    .
+    //   ,  propagate_on_container_copy_assignment 
+    // propagate_on_container_move_assignment   rhs: Swap   
+    void Replace(RawMemory&& other) noexcept
+    {
+        Deallocate(buffer_, capacity_);
+        alloc_ = std::move(other.alloc_);
+        buffer_ = std::exchange(other.buffer_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+
     const T* GetAddress() const noexcept 
     {
         return buffer_;
@@ -78,455 +285,1682 @@ public:
         return capacity_;
     }
 
+    const allocator_type& GetAllocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    //     new_capacity,    
+    bool TryExpand(size_t new_capacity) noexcept
+    {
+        if constexpr (detail::HasExpand<allocator_type, T>::value)
+        {
+            if (buffer_ != nullptr && new_capacity > capacity_ && alloc_.expand(buffer_, capacity_, new_capacity))
+            {
+                capacity_ = new_capacity;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //    new_capacity ,      .
+    //    CAN_REALLOCATE
+    void Reallocate(size_t new_capacity)
+    {
+        static_assert(CAN_REALLOCATE);
+        if (buffer_ == nullptr)
+        {
+            buffer_ = Allocate(new_capacity);
+        }
+        else
+        {
+            buffer_ = alloc_.reallocate(buffer_, capacity_, new_capacity);
+        }
+        capacity_ = new_capacity;
+    }
+
 private:
     //     n      
-    static T* Allocate(size_t n) 
+    T* Allocate(size_t n) 
     {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+        return n != 0 ? AllocTraits::allocate(alloc_, n) : nullptr;
     }
 
-    //   ,     buf   Allocate
-    static void Deallocate(T* buf) noexcept 
+    //     n ,     buf   Allocate
+    void Deallocate(T* buf, size_t n) noexcept 
     {
-        operator delete(buf);
+        if (buf != nullptr)
+        {
+            AllocTraits::deallocate(alloc_, buf, n);
+        }
     }
 
+    [[no_unique_address]] allocator_type alloc_;
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
 
+//    ,     .
+// NextCapacity<T>(capacity, required)      required
+
+//  
+struct DoublingGrowth
+{
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        return std::max(capacity == 0 ? 1 : capacity * 2, required);
+    }
+};
+
+//   1.5 :        ,     
+struct OneAndHalfGrowth
+{
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        return std::max(capacity + capacity / 2 + 1, required);
+    }
+};
+
+//      MinCapacity 
+template <size_t MinCapacity, typename Base = DoublingGrowth>
+struct MinCapacityGrowth
+{
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        return std::max(Base::template NextCapacity<T>(capacity, required), MinCapacity);
+    }
+};
+
+//      MinBytes  (, -)
+template <size_t MinBytes, typename Base = DoublingGrowth>
+struct MinBytesGrowth
+{
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        return std::max(Base::template NextCapacity<T>(capacity, required), (MinBytes + sizeof(T) - 1) / sizeof(T));
+    }
+};
+
+//        (  ),
+//    PageSize  -    ,      
+template <typename Base = DoublingGrowth, size_t PageSize = 4096>
+struct SizeClassGrowth
+{
+    static_assert(std::has_single_bit(PageSize));
+
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        const size_t bytes = Base::template NextCapacity<T>(capacity, required) * sizeof(T);
+        const size_t rounded = bytes < PageSize ? std::bit_ceil(bytes) : (bytes + PageSize - 1) / PageSize * PageSize;
+        return rounded / sizeof(T);
+    }
+};
+
+//       , 
+// ShrinkCapacity<T>(capacity, size): ,       .
+//  capacity ,    
+
+//        capacity / Divisor,    size * Factor.
+//                 
+template <typename Base = DoublingGrowth, size_t Divisor = 4, size_t Factor = 2>
+struct AutoShrink
+{
+    static_assert(Factor > 0 && Factor < Divisor);
+
+    template <typename T>
+    static constexpr size_t NextCapacity(size_t capacity, size_t required) noexcept
+    {
+        return Base::template NextCapacity<T>(capacity, required);
+    }
+
+    template <typename T>
+    static constexpr size_t ShrinkCapacity(size_t capacity, size_t size) noexcept
+    {
+        return size < capacity / Divisor ? size * Factor : capacity;
+    }
+};
+
+namespace detail
+{
+
+template <typename GrowthPolicy, typename T>
+concept HasShrinkCapacity = requires(size_t n)
+{
+    { GrowthPolicy::template ShrinkCapacity<T>(n, n) } -> std::convertible_to<size_t>;
+};
+
+} // namespace detail
+
+//        :
+//   OnAllocate(capacity, bytes) -    capacity ;
+//   OnGrow(old_capacity, new_capacity) -        ;
+//   OnRelocate(bitwise, moved, copied) -      ,
+//        (    noexcept).
+//  OnExpand(old_capacity, new_capacity, bytes) ,  allocator.expand 
+//     bytes ;      OnGrow,  OnAllocate.
+//  OnDestroy(size)   ,    size .
+//          
+struct NoInstrumentation
+{
+    static void OnAllocate(size_t /*capacity*/, size_t /*bytes*/) noexcept {}
+    static void OnGrow(size_t /*old_capacity*/, size_t /*new_capacity*/) noexcept {}
+    static void OnRelocate(size_t /*bitwise*/, size_t /*moved*/, size_t /*copied*/) noexcept {}
+};
+
+namespace detail
+{
+
+template <typename Instrumentation>
+concept HasOnExpand = requires(size_t n)
+{
+    Instrumentation::OnExpand(n, n, n);
+};
+
+template <typename Instrumentation>
+concept HasOnDestroy = requires(size_t n)
+{
+    Instrumentation::OnDestroy(n);
+};
+
+} // namespace detail
+
+//  ,     
+struct default_init_t
+{
+    explicit default_init_t() = default;
+};
+
+inline constexpr default_init_t default_init{};
+
+//   ,    
+struct parallel_t
+{
+    //  ,  ; 0  std::thread::hardware_concurrency()
+    unsigned threads = 0;
+    //        
+    size_t min_chunk_size = 16 * 1024;
+    //    i       ( Linux).   NumaAllocator
+    //  ,   ,    NUMA  ,
+    //  Vector::ForEachChunk           
+    bool pin_threads = false;
+};
+
+inline constexpr parallel_t parallel{};
+
+namespace detail
+{
+
+inline size_t ChunkCount(const parallel_t& policy, size_t count) noexcept
+{
+    const size_t threads = policy.threads != 0 ? policy.threads : std::max(1u, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(threads, count / std::max<size_t>(policy.min_chunk_size, 1)));
+}
+
+//   .     ,    
+//    
+inline constexpr size_t PAGE_SIZE = 4096;
+
+//   T,    
 template <typename T>
-class Vector
+constexpr size_t PageGranule() noexcept
+{
+    return PAGE_SIZE % sizeof(T) == 0 ? PAGE_SIZE / sizeof(T) : 1;
+}
+
+//   chunk   count   chunks   .
+//       granule
+inline size_t ChunkBegin(size_t count, size_t chunks, size_t chunk, size_t granule = 1) noexcept
+{
+    if (chunk == chunks)
+    {
+        return count;
+    }
+    const size_t begin = count / chunks * chunk + std::min(chunk, count % chunks);
+    return begin / granule * granule;
+}
+
+//       chunk:     ,
+//  .     
+class ThreadPin
 {
 public:
-    Vector() = default;
+    ThreadPin(bool enabled, [[maybe_unused]] size_t chunk, [[maybe_unused]] size_t chunks) noexcept
+    {
+#if defined(__linux__)
+        if (!enabled || sched_getaffinity(0, sizeof(saved_), &saved_) != 0)
+        {
+            return;
+        }
+        const size_t allowed = static_cast<size_t>(CPU_COUNT(&saved_));
+        size_t target = chunk * allowed / chunks;
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &saved_) && target-- == 0)
+            {
+                cpu_set_t single;
+                CPU_ZERO(&single);
+                CPU_SET(cpu, &single);
+                pinned_ = sched_setaffinity(0, sizeof(single), &single) == 0;
+                return;
+            }
+        }
+#else
+        (void)enabled;
+#endif
+    }
 
-    explicit Vector(size_t size);
+    ThreadPin(const ThreadPin&) = delete;
+    ThreadPin& operator=(const ThreadPin&) = delete;
 
-    Vector(const Vector& other);
+    ~ThreadPin()
+    {
+#if defined(__linux__)
+        if (pinned_)
+        {
+            sched_setaffinity(0, sizeof(saved_), &saved_);
+        }
+#endif
+    }
 
-    Vector(Vector&& other) noexcept;
+private:
+#if defined(__linux__)
+    cpu_set_t saved_;
+    bool pinned_ = false;
+#endif
+};
 
-    using iterator = T*;
-    using const_iterator = const T*;
+//  body(chunk, first, last)    chunks   [0, count):     ,
+//   .     ,     .
+// Body    
+template <typename Body>
+void ForEachChunk(const parallel_t& policy, size_t count, size_t chunks, size_t granule, const Body& body) noexcept
+{
+    const auto run = [&body, &policy, count, chunks, granule](size_t chunk) {
+        const ThreadPin pin(policy.pin_threads && chunks > 1, chunk, chunks);
+        body(chunk, ChunkBegin(count, chunks, chunk, granule), ChunkBegin(count, chunks, chunk + 1, granule));
+    };
+    std::unique_ptr<std::thread[]> workers;
+    try
+    {
+        workers.reset(new std::thread[chunks - 1]);
+    }
+    catch (...)
+    {
+    }
+    for (size_t chunk = 1; chunk < chunks; ++chunk)
+    {
+        try
+        {
+            if (workers)
+            {
+                workers[chunk - 1] = std::thread(run, chunk);
+                continue;
+            }
+        }
+        catch (...)
+        {
+        }
+        run(chunk);
+    }
+    run(0);
+    for (size_t i = 0; workers && i + 1 < chunks; ++i)
+    {
+        if (workers[i].joinable())
+        {
+            workers[i].join();
+        }
+    }
+}
+
+//   count     dest  construct(dest + first, first, n),
+//        .       ,
+//         
+template <typename T, typename Construct>
+void ParallelConstruct(const parallel_t& policy, T* dest, size_t count, const Construct& construct)
+{
+    const size_t chunks = ChunkCount(policy, count);
+    if (chunks == 1)
+    {
+        construct(dest, 0, count);
+        return;
+    }
+    const size_t granule = PageGranule<T>();
+    std::unique_ptr<bool[]> done(new bool[chunks]());
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    ForEachChunk(policy, count, chunks, granule, [&](size_t chunk, size_t first, size_t last) {
+        try
+        {
+            construct(dest + first, first, last - first);
+            done[chunk] = true;
+        }
+        catch (...)
+        {
+            std::lock_guard lock(error_mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+        });
+    if (error)
+    {
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            if (done[chunk])
+            {
+                const size_t first = ChunkBegin(count, chunks, chunk, granule);
+                std::destroy_n(dest + first, ChunkBegin(count, chunks, chunk + 1, granule) - first);
+            }
+        }
+        std::rethrow_exception(error);
+    }
+}
+
+//  body(first, last)    [0, count)   .
+//    granule.         
+template <typename Body>
+void ParallelFor(const parallel_t& policy, size_t count, const Body& body, size_t granule = 1)
+{
+    const size_t chunks = ChunkCount(policy, count);
+    if (chunks == 1)
+    {
+        body(size_t{ 0 }, count);
+        return;
+    }
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    ForEachChunk(policy, count, chunks, granule, [&](size_t /*chunk*/, size_t first, size_t last) {
+        try
+        {
+            body(first, last);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(error_mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+        });
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+template <typename T>
+void ParallelDestroy(const parallel_t& policy, T* data, size_t count) noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        ForEachChunk(policy, count, ChunkCount(policy, count), PageGranule<T>(),
+            [data](size_t /*chunk*/, size_t first, size_t last) {
+                std::destroy(data + first, data + last);
+            });
+    }
+}
+
+} // namespace detail
+
+//       ,    new
+template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = DoublingGrowth,
+    typename Instrumentation = NoInstrumentation>
+class Vector
+{
+    using AllocTraits = std::allocator_traits<typename RawMemory<T, Allocator>::allocator_type>;
+
+public:
+    using allocator_type = typename RawMemory<T, Allocator>::allocator_type;
+
+    Vector() = default;
+
+    explicit Vector(const allocator_type& alloc) noexcept;
+
+    explicit Vector(size_t size, const allocator_type& alloc = allocator_type());
+
+    //    :    
+    Vector(size_t size, default_init_t, const allocator_type& alloc = allocator_type());
+
+    Vector(const Vector& other);
+
+    Vector(const Vector& other, const allocator_type& alloc);
+
+    Vector(Vector&& other) noexcept;
+
+    //     data,  size    
+    Vector(RawMemory<T, Allocator>&& data, size_t size) noexcept;
+
+    //   :       policy.
+    //     ,      
+    Vector(const parallel_t& policy, size_t size, const allocator_type& alloc = allocator_type());
+
+    Vector(const parallel_t& policy, const Vector& other);
+
+    Vector(const parallel_t& policy, const Vector& other, const allocator_type& alloc);
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept
+    {
+        return data_ + 0;
+    }
+    iterator end() noexcept
+    {
+        return data_ + size_;
+    }
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return data_ + 0;
+    }
+    const_iterator cend() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    size_t Size() const noexcept;
+    size_t Capacity() const noexcept;
+    const T& operator[](size_t index) const noexcept;
+    T& operator[](size_t index) noexcept;
+    void Reserve(size_t new_capacity);
+    Vector& operator=(const Vector& rhs);
+    Vector& operator=(Vector&& rhs) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+        || AllocTraits::is_always_equal::value);
+    void Swap(Vector& other) noexcept;
+    const allocator_type& GetAllocator() const noexcept;
+    void Resize(size_t new_size);
+
+    //   .  ,      ShrinkCapacity
+    void Clear() noexcept;
+
+    //    .  Vector ,
+    //        
+    void Clear(const parallel_t& policy) noexcept;
+
+    //    .     
+    //     ,      rhs
+    void Assign(const parallel_t& policy, const Vector& rhs);
+
+    //  body(first, last)      .      ,
+    //        .     
+    //   
+    template <typename Body>
+    void ForEachChunk(const parallel_t& policy, const Body& body);
+    template <typename Body>
+    void ForEachChunk(const parallel_t& policy, const Body& body) const;
+
+    //    .     ,   
+    void ShrinkToFit();
+
+    //  Resize,      ,    
+    void ResizeDefaultInit(size_t new_size);
+
+    //    max_size       operation(data, max_size)
+    //   . Operation      max_size,   
+    template <typename Operation>
+    void ResizeAndOverwrite(size_t max_size, Operation operation);
+
+    template <typename V>
+    void PushBack(V&& value);
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args);
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args)
+    {
+        assert(cbegin() <= pos && pos <= cend());
+        const size_t pos_t = pos - cbegin();
+        if (pos_t == size_)
+        {
+            return std::addressof(EmplaceBack(std::forward<Args>(args)...));
+        }
+        if (size_ == Capacity())
+        {
+            const size_t new_capacity = GrowthCapacity(size_ + 1);
+            if (!TryExpand(new_capacity))
+            {
+                Instrumentation::OnGrow(Capacity(), new_capacity);
+                return GrowAndEmplace(pos_t, new_capacity, std::forward<Args>(args)...);
+            }
+        }
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>
+            || (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>))
+        {
+            //     ,    
+            if (ArgsAlias(args...))
+            {
+                T temp(std::forward<Args>(args)...);
+                ShiftAndConstruct(pos_t, std::move(temp));
+            }
+            else
+            {
+                ShiftAndConstruct(pos_t, std::forward<Args>(args)...);
+            }
+        }
+        else
+        {
+            //    ,      
+            detail::ShiftInsert(data_ + pos_t, data_ + size_, data_ + size_, std::forward<Args>(args)...);
+        }
+        ++size_;
+        return data_ + pos_t;
+    }
+
+    template <typename V>
+    iterator Insert(const_iterator pos, V&& value)
+    {
+        return Emplace(pos, std::forward<V>(value));
+    }
+
+    //    [first, last)  pos,      .
+    //        
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    iterator Insert(const_iterator pos, InputIt first, InputIt last);
+
+    //  count  value  pos
+    iterator Insert(const_iterator pos, size_t count, const T& value);
+
+    //      
+    template <typename Range>
+    void Append(const Range& range)
+    {
+        Insert(cend(), std::begin(range), std::end(range));
+    }
+
+    //      [first, last),     .
+    //        memmove
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    void Assign(InputIt first, InputIt last);
+
+    //    rhs   .  rhs  ,  
+    //    ,        
+    void Assign(const Vector& rhs);
+
+    //    [first, last),     
+    iterator Erase(const_iterator first, const_iterator last);
+
+    //  ,   pred(element) ,       
+    //    .  pred  ,      
+    template <typename Predicate>
+    size_t EraseIf(Predicate pred);
+
+    //  pos  O(1),      .    
+    iterator UnorderedErase(const_iterator pos);
+
+    //         sorted_indices   
+    template <typename Range>
+    void EraseIndices(const Range& sorted_indices);
+
+    //    ShrinkCapacity        
+    void PopBack() noexcept;
+    T& Back() noexcept;
+    iterator Erase(const_iterator pos)
+    {
+        assert((pos >= data_ + 0) && (pos < end()));
+        const size_t pos_t = pos - data_.GetAddress();
+        std::move(data_ + pos_t + 1, data_ + size_, data_ + pos_t);
+        Destroy(data_ + size_ - 1);
+        --size_;
+        MaybeShrink();
+        return data_ + pos_t;
+    }
+
+    ~Vector();
+
+private:
+    RawMemory<T, Allocator> data_;
+    size_t size_ = 0;
+
+    //    elem      buf
+    template<typename... Args>
+    static void CopyConstruct(T* buf, Args&&... args);
+
+    template<typename... Args>
+    static void MoveConstruct(T* buf, Args&&... args);
+
+    template<typename... Args>
+    static void ForwardConstruct(T* buf, Args&&... args);
+
+    //      buf
+    static void Destroy(T* buf) noexcept;
+
+    //    new_data,    gap_size  
+    //    gap ( gap == size_  ),   new_data  .
+    //    ,    
+    void RelocateTo(RawMemory<T, Allocator>& new_data, size_t gap, size_t gap_size = 1);
+
+    //      ,    other.
+    //  ,   rhs   
+    void TakeOver(Vector&& other) noexcept;
+
+    //  count    [first, last)   pos
+    template <typename ForwardIt>
+    T* InsertRange(size_t pos, ForwardIt first, ForwardIt last, size_t count);
+
+    //          OnExpand
+    bool TryExpand(size_t new_capacity) noexcept
+    {
+        const size_t old_capacity = Capacity();
+        if (!data_.TryExpand(new_capacity))
+        {
+            return false;
+        }
+        if constexpr (detail::HasOnExpand<Instrumentation>)
+        {
+            Instrumentation::OnExpand(old_capacity, new_capacity, (new_capacity - old_capacity) * sizeof(T));
+        }
+        return true;
+    }
+
+    //           
+    RawMemory<T, Allocator> AllocateBuffer(size_t capacity)
+    {
+        NoteAllocation(capacity);
+        return RawMemory<T, Allocator>(capacity, data_.GetAllocator());
+    }
+
+    //     allocator.reallocate
+    void ReallocateBuffer(size_t new_capacity)
+    {
+        NoteAllocation(new_capacity);
+        data_.Reallocate(new_capacity);
+        NoteRelocation(size_);
+    }
+
+    static void NoteAllocation(size_t capacity) noexcept
+    {
+        if (capacity != 0)
+        {
+            Instrumentation::OnAllocate(capacity, capacity * sizeof(T));
+        }
+    }
+
+    // ,     count    
+    static void NoteRelocation(size_t count) noexcept
+    {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            Instrumentation::OnRelocate(count, 0, 0);
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            Instrumentation::OnRelocate(0, count, 0);
+        }
+        else
+        {
+            Instrumentation::OnRelocate(0, 0, count);
+        }
+    }
+
+    //   [pos, size_)          
+    //    .       .
+    //    ,    
+    template <typename... Args>
+    void ShiftAndConstruct(size_t pos, Args&&... args);
+
+    // ,          
+    template <typename... Args>
+    bool ArgsAlias(const Args&... args) const noexcept
+    {
+        const auto* first = reinterpret_cast<const std::byte*>(data_.GetAddress());
+        const auto* last = reinterpret_cast<const std::byte*>(data_.GetAddress() + size_);
+        const auto inside = [first, last](const void* arg) {
+            const auto* p = static_cast<const std::byte*>(arg);
+            return !std::less<const std::byte*>{}(p, first) && std::less<const std::byte*>{}(p, last);
+        };
+        return (inside(std::addressof(args)) || ...);
+    }
+
+    //      new_capacity >= size_ 
+    void ShrinkTo(size_t new_capacity);
+
+    //    ShrinkCapacity  .     
+    // :  ,      .  
+    //     :       
+    void MaybeShrink() noexcept
+    {
+        if constexpr (detail::HasShrinkCapacity<GrowthPolicy, T>
+            && (IS_TRIVIALLY_RELOCATABLE<T> || std::is_nothrow_move_constructible_v<T> || std::is_copy_constructible_v<T>))
+        {
+            const size_t new_capacity = std::max<size_t>(GrowthPolicy::template ShrinkCapacity<T>(Capacity(), size_), size_);
+            if (new_capacity < Capacity())
+            {
+                try
+                {
+                    ShrinkTo(new_capacity);
+                }
+                catch (...)
+                {
+                }
+            }
+        }
+    }
+
+    // ,    ,   required 
+    size_t GrowthCapacity(size_t required) const noexcept
+    {
+        return std::max(GrowthPolicy::template NextCapacity<T>(Capacity(), required), required);
+    }
+
+    //    new_capacity          pos
+    template <typename... Args>
+    T* GrowAndEmplace(size_t pos, size_t new_capacity, Args&&... args);
+};
+
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline size_t Vector<T, Allocator, GrowthPolicy, Instrumentation>::Size() const noexcept
+{
+    return size_;
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline size_t Vector<T, Allocator, GrowthPolicy, Instrumentation>::Capacity() const noexcept
+{
+    return data_.Capacity();
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline const T& Vector<T, Allocator, GrowthPolicy, Instrumentation>::operator[](size_t index) const noexcept
+{
+    return const_cast<Vector&>(*this)[index];
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline T& Vector<T, Allocator, GrowthPolicy, Instrumentation>::operator[](size_t index) noexcept
+{
+    assert(index < size_);
+    return data_[index];
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Reserve(size_t new_capacity)
+{
+    if (new_capacity <= data_.Capacity())
+    {
+        return;
+    }
+    if (TryExpand(new_capacity))
+    {
+        return;
+    }
+    if constexpr (RawMemory<T, Allocator>::CAN_REALLOCATE)
+    {
+        ReallocateBuffer(new_capacity);
+    }
+    else
+    {
+        RawMemory<T, Allocator> new_data = AllocateBuffer(new_capacity);
+        RelocateTo(new_data, size_);
+    }
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::RelocateTo(RawMemory<T, Allocator>& new_data, size_t gap, size_t gap_size)
+{
+    assert(gap <= size_ && size_ + (gap == size_ ? 0 : gap_size) <= new_data.Capacity());
+    detail::RelocateWithGap(data_.GetAddress(), size_, new_data.GetAddress(), gap, gap_size);
+    NoteRelocation(size_);
+    data_.Swap(new_data);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>& Vector<T, Allocator, GrowthPolicy, Instrumentation>::operator=(const Vector<T, Allocator, GrowthPolicy, Instrumentation>& rhs)
+{
+    if (this != &rhs) {
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value
+            && !AllocTraits::is_always_equal::value)
+        {
+            if (data_.GetAllocator() != rhs.data_.GetAllocator())
+            {
+                Vector rhs_copy(rhs, rhs.data_.GetAllocator());
+                TakeOver(std::move(rhs_copy));
+                return *this;
+            }
+        }
+        Assign(rhs);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>& Vector<T, Allocator, GrowthPolicy, Instrumentation>::operator=(Vector<T, Allocator, GrowthPolicy, Instrumentation>&& rhs)
+    noexcept(AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value)
+{
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+    {
+        //  rhs     
+        if (this != &rhs)
+        {
+            TakeOver(std::move(rhs));
+        }
+    }
+    else
+    {
+        if constexpr (!AllocTraits::is_always_equal::value)
+        {
+            //    :    ,   
+            if (data_.GetAllocator() != rhs.data_.GetAllocator())
+            {
+                Vector moved(data_.GetAllocator());
+                moved.Reserve(rhs.size_);
+                std::uninitialized_move_n(rhs.data_.GetAddress(), rhs.size_, moved.data_.GetAddress());
+                moved.size_ = rhs.size_;
+                Swap(moved);
+                return *this;
+            }
+        }
+        Swap(rhs);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Swap(Vector& other) noexcept
+{
+    data_.Swap(other.data_);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::TakeOver(Vector&& other) noexcept
+{
+    std::destroy_n(data_.GetAddress(), size_);
+    data_.Replace(std::move(other.data_));
+    size_ = std::exchange(other.size_, 0);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline const typename Vector<T, Allocator, GrowthPolicy, Instrumentation>::allocator_type& Vector<T, Allocator, GrowthPolicy, Instrumentation>::GetAllocator() const noexcept
+{
+    return data_.GetAllocator();
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const allocator_type& alloc) noexcept
+    : data_(alloc)
+{
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(size_t size, const allocator_type& alloc)
+    : data_(size, alloc)
+    , size_(size)
+{
+    NoteAllocation(size);
+    std::uninitialized_value_construct_n(data_.GetAddress(), size);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(size_t size, default_init_t, const allocator_type& alloc)
+    : data_(size, alloc)
+    , size_(size)
+{
+    NoteAllocation(size);
+    std::uninitialized_default_construct_n(data_.GetAddress(), size);
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const Vector& other)
+    : Vector(other, AllocTraits::select_on_container_copy_construction(other.data_.GetAllocator()))
+{
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const Vector& other, const allocator_type& alloc)
+    : data_(other.Size(), alloc)
+    , size_(other.Size())
+{
+    NoteAllocation(other.Size());
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        detail::CopyBytes(data_.GetAddress(), other.data_.GetAddress(), other.Size());
+    }
+    else
+    {
+        std::uninitialized_copy_n(other.data_.GetAddress(), other.Size(), data_.GetAddress());
+    }
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const parallel_t& policy, size_t size, const allocator_type& alloc)
+    : data_(size, alloc)
+{
+    NoteAllocation(size);
+    detail::ParallelConstruct(policy, data_.GetAddress(), size, [](T* to, size_t /*first*/, size_t n) {
+        std::uninitialized_value_construct_n(to, n);
+        });
+    size_ = size;
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const parallel_t& policy, const Vector& other)
+    : Vector(policy, other, AllocTraits::select_on_container_copy_construction(other.data_.GetAllocator()))
+{
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(const parallel_t& policy, const Vector& other, const allocator_type& alloc)
+    : data_(other.Size(), alloc)
+{
+    NoteAllocation(other.Size());
+    detail::ParallelConstruct(policy, data_.GetAddress(), other.Size(),
+        [source = other.data_.GetAddress()](T* to, size_t first, size_t n) {
+            std::uninitialized_copy_n(source + first, n, to);
+        });
+    size_ = other.Size();
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(Vector&& other) noexcept
+    : data_(std::move(other.data_))
+    , size_(std::exchange(other.size_, 0))
+{
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::Vector(RawMemory<T, Allocator>&& data, size_t size) noexcept
+    : data_(std::move(data))
+    , size_(size)
+{
+    assert(size_ <= data_.Capacity());
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Resize(size_t new_size)
+{
+    if (new_size <= size_)
+    {
+        std::destroy_n(data_ + new_size, size_ - new_size);
+        size_ = new_size;
+        MaybeShrink();
+    }
+    else
+    {
+        size_t count_new_elem = new_size - size_;
+        if (Capacity() < new_size)
+        {
+            Reserve(new_size);
+        }
+        std::uninitialized_value_construct_n(data_ + size_, count_new_elem);
+        size_ = new_size;
+    }
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ResizeDefaultInit(size_t new_size)
+{
+    if (new_size <= size_)
+    {
+        std::destroy_n(data_ + new_size, size_ - new_size);
+        size_ = new_size;
+        MaybeShrink();
+    }
+    else
+    {
+        Reserve(new_size);
+        std::uninitialized_default_construct_n(data_ + size_, new_size - size_);
+        size_ = new_size;
+    }
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Clear() noexcept
+{
+    std::destroy_n(data_.GetAddress(), size_);
+    size_ = 0;
+    MaybeShrink();
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Clear(const parallel_t& policy) noexcept
+{
+    detail::ParallelDestroy(policy, data_.GetAddress(), size_);
+    size_ = 0;
+    MaybeShrink();
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Assign(const parallel_t& policy, const Vector& rhs)
+{
+    if (this == &rhs)
+    {
+        return;
+    }
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value && !AllocTraits::is_always_equal::value)
+    {
+        if (data_.GetAllocator() != rhs.data_.GetAllocator())
+        {
+            Vector rhs_copy(policy, rhs, rhs.data_.GetAllocator());
+            Clear(policy);
+            TakeOver(std::move(rhs_copy));
+            return;
+        }
+    }
+    if (rhs.size_ > Capacity())
+    {
+        Vector rhs_copy(policy, rhs, data_.GetAllocator());
+        Swap(rhs_copy);
+        rhs_copy.Clear(policy);
+        return;
+    }
+    T* dest = data_.GetAddress();
+    const T* source = rhs.data_.GetAddress();
+    detail::ParallelFor(policy, std::min(size_, rhs.size_), [dest, source](size_t first, size_t last) {
+        std::copy(source + first, source + last, dest + first);
+        }, detail::PageGranule<T>());
+    if (rhs.size_ < size_)
+    {
+        detail::ParallelDestroy(policy, dest + rhs.size_, size_ - rhs.size_);
+    }
+    else
+    {
+        detail::ParallelConstruct(policy, dest + size_, rhs.size_ - size_,
+            [source = source + size_](T* to, size_t first, size_t n) {
+                std::uninitialized_copy_n(source + first, n, to);
+            });
+    }
+    size_ = rhs.size_;
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template <typename Body>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ForEachChunk(const parallel_t& policy, const Body& body)
+{
+    T* data = data_.GetAddress();
+    detail::ParallelFor(policy, size_, [data, &body](size_t first, size_t last) {
+        body(data + first, data + last);
+        }, detail::PageGranule<T>());
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template <typename Body>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ForEachChunk(const parallel_t& policy, const Body& body) const
+{
+    const T* data = data_.GetAddress();
+    detail::ParallelFor(policy, size_, [data, &body](size_t first, size_t last) {
+        body(data + first, data + last);
+        }, detail::PageGranule<T>());
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ShrinkToFit()
+{
+    if (size_ < Capacity())
+    {
+        ShrinkTo(size_);
+    }
+}
 
-    iterator begin() noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ShrinkTo(size_t new_capacity)
+{
+    assert(size_ <= new_capacity && new_capacity <= Capacity());
+    if (new_capacity == 0)
     {
-        return data_ + 0;
+        RawMemory<T, Allocator> empty(data_.GetAllocator());
+        data_.Swap(empty);
     }
-    iterator end() noexcept
+    else if constexpr (RawMemory<T, Allocator>::CAN_REALLOCATE)
     {
-        return data_ + size_;
+        ReallocateBuffer(new_capacity);
     }
-    const_iterator begin() const noexcept
+    else
     {
-        return cbegin();
+        RawMemory<T, Allocator> new_data = AllocateBuffer(new_capacity);
+        RelocateTo(new_data, size_);
     }
-    const_iterator end() const noexcept
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename Operation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ResizeAndOverwrite(size_t max_size, Operation operation)
+{
+    const size_t old_size = size_;
+    if (max_size > size_)
     {
-        return cend();
+        ResizeDefaultInit(max_size);
     }
-    const_iterator cbegin() const noexcept
+    size_t new_size = 0;
+    try
     {
-        return data_ + 0;
+        new_size = static_cast<size_t>(std::move(operation)(data_.GetAddress(), max_size));
     }
-    const_iterator cend() const noexcept
+    catch (...)
     {
-        return data_ + size_;
+        if (size_ > old_size)
+        {
+            std::destroy_n(data_ + old_size, size_ - old_size);
+            size_ = old_size;
+        }
+        throw;
     }
+    assert(new_size <= max_size);
+    std::destroy_n(data_ + new_size, size_ - new_size);
+    size_ = new_size;
+}
 
-    size_t Size() const noexcept;
-    size_t Capacity() const noexcept;
-    const T& operator[](size_t index) const noexcept;
-    T& operator[](size_t index) noexcept;
-    void Reserve(size_t new_capacity);
-    Vector& operator=(const Vector& rhs);
-    Vector& operator=(Vector&& rhs) noexcept;
-    void Swap(Vector& other) noexcept;
-    void Resize(size_t new_size);
-
-    template <typename V>
-    void PushBack(V&& value);
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename InputIt>
+    requires std::input_iterator<InputIt>
+inline typename Vector<T, Allocator, GrowthPolicy, Instrumentation>::iterator
+Vector<T, Allocator, GrowthPolicy, Instrumentation>::Insert(const_iterator pos, InputIt first, InputIt last)
+{
+    assert(pos >= cbegin() && pos <= cend());
+    const size_t pos_t = pos - cbegin();
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        return InsertRange(pos_t, first, last, static_cast<size_t>(std::distance(first, last)));
+    }
+    else
+    {
+        //      :     
+        Vector buffer(data_.GetAllocator());
+        for (; first != last; ++first)
+        {
+            buffer.EmplaceBack(*first);
+        }
+        return InsertRange(pos_t, std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()),
+            buffer.Size());
+    }
+}
 
-    template <typename... Args>
-    T& EmplaceBack(Args&&... args);
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline typename Vector<T, Allocator, GrowthPolicy, Instrumentation>::iterator
+Vector<T, Allocator, GrowthPolicy, Instrumentation>::Insert(const_iterator pos, size_t count, const T& value)
+{
+    assert(pos >= cbegin() && pos <= cend());
+    const size_t pos_t = pos - cbegin();
+    // value      
+    const T copy(value);
+    return InsertRange(pos_t, detail::RepeatIterator<T>(copy, 0), detail::RepeatIterator<T>(copy, count), count);
+}
 
-    template <typename... Args>
-    iterator Emplace(const_iterator pos, Args&&... args)
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename ForwardIt>
+inline T* Vector<T, Allocator, GrowthPolicy, Instrumentation>::InsertRange(size_t pos, ForwardIt first, ForwardIt last, size_t count)
+{
+    if (count == 0)
     {
-        size_t pos_t = pos - begin();
-        if (size_ == Capacity())
+        return data_ + pos;
+    }
+    const size_t tail = size_ - pos;
+    if (size_ + count > Capacity())
+    {
+        const size_t new_capacity = GrowthCapacity(size_ + count);
+        if (!TryExpand(new_capacity))
         {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-            try
-            {
-                ForwardConstruct(new_data + pos_t, (std::forward<Args>(args))...);
-            }
-            catch (...)
-            {
-                Destroy(new_data + pos_t);
-                throw;
-            }
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            Instrumentation::OnGrow(Capacity(), new_capacity);
+            if constexpr (RawMemory<T, Allocator>::CAN_REALLOCATE)
             {
-                std::uninitialized_move_n(data_.GetAddress(), pos_t, new_data.GetAddress());
-                std::uninitialized_move_n(data_ + pos_t, size_ - pos_t, new_data + pos_t + 1);
+                ReallocateBuffer(new_capacity);
             }
             else
             {
-                std::uninitialized_copy_n(data_.GetAddress(), pos_t, new_data.GetAddress());
-                std::uninitialized_copy_n(data_ + pos_t, size_ - pos_t, new_data + pos_t + 1);
-            }
-            data_.Swap(new_data);
-            std::destroy_n(new_data.GetAddress(), size_);
-        }
-        else
-        {            
-            try
-            {
-                if (size_ != 0)
-                {
-                    T temp((std::forward<Args>(args))...);
-                    ForwardConstruct(data_ + size_, std::forward<T>(data_[size_ - 1]));
-                    std::move_backward(data_ + pos_t, data_ + (size_ - 1), data_ + size_);  
-                    data_[pos_t] = std::forward<T>(temp);
-                }
-                else
-                {
-                    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
-                    {
-                        ForwardConstruct(data_ + pos_t, (std::forward<Args>(args))...);
-                    }
-                    else
-                    {
-                        CopyConstruct(data_ + pos_t, (std::forward<Args>(args))...);
-                    }
-                }
-            }
-            catch (...)
-            {
-                Destroy(data_ + pos_t);
-                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                RawMemory<T, Allocator> new_data = AllocateBuffer(new_capacity);
+                std::uninitialized_copy(first, last, new_data + pos);
+                try
                 {
-                    ForwardConstruct(data_ + pos_t, std::forward<T>(data_[size_ + pos_t + 1]));
-                    std::move(data_ + pos_t + 2, data_ + size_, data_ + pos_t + 1);
+                    RelocateTo(new_data, pos, count);
                 }
-                else
+                catch (...)
                 {
-                    CopyConstruct(data_ + pos_t, std::forward<T>(data_[size_ + pos_t + 1]));
-                    std::copy(data_ + pos_t + 2, data_ + size_, data_ + pos_t + 1);
+                    std::destroy_n(new_data + pos, count);
+                    throw;
                 }
-                throw;
+                size_ += count;
+                return data_ + pos;
             }
         }
-        ++size_;
-        return data_ + pos_t;
     }
-
-    template <typename V>
-    iterator Insert(const_iterator pos, V&& value)
+    T* gap = data_ + pos;
+    T* old_end = data_ + size_;
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
     {
-        return Emplace(pos, std::forward<V>(value));
+        detail::RelocateBytes(gap + count, gap, tail);
+        try
+        {
+            std::uninitialized_copy(first, last, gap);
+        }
+        catch (...)
+        {
+            detail::RelocateBytes(gap, gap + count, tail);
+            throw;
+        }
+        size_ += count;
     }
-
-    void PopBack() noexcept;
-    T& Back() noexcept;
-    iterator Erase(const_iterator pos)
+    else if (tail > count)
     {
-        assert((pos >= data_ + 0) && (pos < end()));
-        const size_t pos_t = pos - data_.GetAddress();
-        std::move(data_ + pos_t + 1, data_ + size_, data_ + pos_t);
-        Destroy(data_ + size_ - 1);
-        --size_;
-        return data_ + pos_t;
+        std::uninitialized_move(old_end - count, old_end, old_end);
+        size_ += count;
+        std::move_backward(gap, old_end - count, old_end);
+        std::copy(first, last, gap);
     }
-
-    ~Vector();
-
-private:
-    RawMemory<T> data_;
-    size_t size_ = 0;
-
-    //    elem      buf
-    template<typename... Args>
-    static void CopyConstruct(T* buf, Args&&... args);
-
-    template<typename... Args>
-    static void MoveConstruct(T* buf, Args&&... args);
-
-    template<typename... Args>
-    static void ForwardConstruct(T* buf, Args&&... args);
-
-    //      buf
-    static void Destroy(T* buf) noexcept;
-};
-
-
-template<typename T>
-inline size_t Vector<T>::Size() const noexcept
-{
-    return size_;
-}
-
-template<typename T>
-inline size_t Vector<T>::Capacity() const noexcept
-{
-    return data_.Capacity();
+    else
+    {
+        ForwardIt middle = std::next(first, tail);
+        std::uninitialized_copy(middle, last, old_end);
+        size_ += count - tail;
+        std::uninitialized_move(gap, old_end, data_ + size_);
+        size_ += tail;
+        std::copy(first, middle, gap);
+    }
+    return gap;
 }
 
-template<typename T>
-inline const T& Vector<T>::operator[](size_t index) const noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename InputIt>
+    requires std::input_iterator<InputIt>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Assign(InputIt first, InputIt last)
 {
-    return const_cast<Vector&>(*this)[index];
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if constexpr (std::contiguous_iterator<InputIt> && std::is_same_v<std::iter_value_t<InputIt>, T>
+            && std::is_trivially_copyable_v<T>)
+        {
+            if (count > Capacity())
+            {
+                RawMemory<T, Allocator> new_data = AllocateBuffer(count);
+                detail::CopyBytes(new_data.GetAddress(), std::to_address(first), count);
+                data_.Swap(new_data);
+            }
+            else
+            {
+                detail::CopyBytes(data_.GetAddress(), std::to_address(first), count);
+            }
+        }
+        else if (count > Capacity())
+        {
+            RawMemory<T, Allocator> new_data = AllocateBuffer(count);
+            std::uninitialized_copy(first, last, new_data.GetAddress());
+            std::destroy_n(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else if (count <= size_)
+        {
+            std::copy(first, last, data_.GetAddress());
+            std::destroy_n(data_ + count, size_ - count);
+        }
+        else
+        {
+            InputIt middle = std::next(first, size_);
+            std::copy(first, middle, data_.GetAddress());
+            std::uninitialized_copy(middle, last, data_ + size_);
+        }
+        size_ = count;
+    }
+    else
+    {
+        size_t assigned = 0;
+        for (; first != last && assigned < size_; ++first, ++assigned)
+        {
+            data_[assigned] = *first;
+        }
+        std::destroy_n(data_ + assigned, size_ - assigned);
+        size_ = assigned;
+        for (; first != last; ++first)
+        {
+            EmplaceBack(*first);
+        }
+    }
 }
 
-template<typename T>
-inline T& Vector<T>::operator[](size_t index) noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Assign(const Vector& rhs)
 {
-    assert(index < size_);
-    return data_[index];
+    if (this == &rhs)
+    {
+        return;
+    }
+    if (rhs.size_ > Capacity())
+    {
+        TryExpand(rhs.size_);
+    }
+    Assign(rhs.cbegin(), rhs.cend());
 }
 
-template<typename T>
-inline void Vector<T>::Reserve(size_t new_capacity)
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline typename Vector<T, Allocator, GrowthPolicy, Instrumentation>::iterator
+Vector<T, Allocator, GrowthPolicy, Instrumentation>::Erase(const_iterator first, const_iterator last)
 {
-    if (new_capacity <= data_.Capacity())
+    assert(cbegin() <= first && first <= last && last <= cend());
+    const size_t pos = first - cbegin();
+    const size_t count = last - first;
+    if (count == 0)
     {
-        return;
+        return data_ + pos;
     }
-    RawMemory<T> new_data(new_capacity);
-    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+    T* gap = data_ + pos;
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
     {
-        std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+        std::destroy_n(gap, count);
+        detail::RelocateBytes(gap, gap + count, size_ - pos - count);
     }
     else
     {
-        std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+        std::move(gap + count, data_ + size_, gap);
+        std::destroy_n(data_ + (size_ - count), count);
     }
-    new_data.Swap(data_);
-    std::destroy_n(new_data.GetAddress(), size_);
+    size_ -= count;
+    MaybeShrink();
+    return data_ + pos;
 }
 
-template<typename T>
-inline Vector<T>& Vector<T>::operator=(const Vector<T>& rhs)
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template <typename Predicate>
+inline size_t Vector<T, Allocator, GrowthPolicy, Instrumentation>::EraseIf(Predicate pred)
 {
-    if (this != &rhs) {
-        if (rhs.size_ > data_.Capacity())
-        {
-            Vector rhs_copy(rhs);
-            Swap(rhs_copy);
-        }
-        else
+    T* data = data_.GetAddress();
+    size_t kept = 0;
+    size_t i = 0;
+    //   [run, i)      kept
+    size_t run = 0;
+    const auto compact = [data, &kept, &run](size_t end) {
+        //    ,     
+        if (run != kept)
         {
-            if (rhs.size_ < size_)
+            if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
             {
-                for (size_t i = 0; i < rhs.size_; ++i)
-                {
-                    data_[i] = rhs[i];
-                }
-                std::destroy_n(data_ + rhs.size_, size_ - rhs.size_);
-                size_ = rhs.size_;
+                detail::RelocateBytes(data + kept, data + run, end - run);
             }
             else
             {
-                for (size_t i = 0; i < size_; ++i)
+                std::move(data + run, data + end, data + kept);
+            }
+        }
+        kept += end - run;
+    };
+    try
+    {
+        for (; i < size_; ++i)
+        {
+            if (pred(std::as_const(data[i])))
+            {
+                compact(i);
+                if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
                 {
-                    data_[i] = rhs[i];
+                    Destroy(data + i);
                 }
-                std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_);
-                size_ = rhs.size_;
+                run = i + 1;
             }
         }
     }
-    return *this;
-}
-
-template<typename T>
-inline Vector<T>& Vector<T>::operator=(Vector<T>&& rhs) noexcept
-{
-    Swap(rhs);
-    return *this;
-}
-
-template<typename T>
-inline void Vector<T>::Swap(Vector& other) noexcept
-{
-    data_.Swap(other.data_);
-    std::swap(size_, other.size_);
-}
-
-template<typename T>
-inline Vector<T>::Vector(size_t size)
-    : data_(size)
-    , size_(size)
-{
-    std::uninitialized_value_construct_n(data_.GetAddress(), size);
-}
-
-template<typename T>
-inline Vector<T>::Vector(const Vector& other)
-    : data_(other.Size())
-    , size_(other.Size())
-{
-    std::uninitialized_copy_n(other.data_.GetAddress(), other.Size(), data_.GetAddress());
+    catch (...)
+    {
+        //     
+        compact(size_);
+        if constexpr (!IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            std::destroy_n(data + kept, size_ - kept);
+        }
+        size_ = kept;
+        throw;
+    }
+    compact(size_);
+    const size_t removed = size_ - kept;
+    if constexpr (!IS_TRIVIALLY_RELOCATABLE<T>)
+    {
+        std::destroy_n(data + kept, removed);
+    }
+    size_ = kept;
+    MaybeShrink();
+    return removed;
 }
 
-template<typename T>
-inline Vector<T>::Vector(Vector&& other) noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline typename Vector<T, Allocator, GrowthPolicy, Instrumentation>::iterator
+Vector<T, Allocator, GrowthPolicy, Instrumentation>::UnorderedErase(const_iterator pos)
 {
-    Swap(other);
+    assert(cbegin() <= pos && pos < cend());
+    const size_t pos_t = pos - cbegin();
+    T* last = data_ + (size_ - 1);
+    if (pos_t != size_ - 1)
+    {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            Destroy(data_ + pos_t);
+            detail::RelocateBytes(data_ + pos_t, last, 1);
+            --size_;
+            MaybeShrink();
+            return data_ + pos_t;
+        }
+        else
+        {
+            data_[pos_t] = std::move(*last);
+        }
+    }
+    PopBack();
+    return data_ + pos_t;
 }
 
-template<typename T>
-inline void Vector<T>::Resize(size_t new_size)
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template <typename Range>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::EraseIndices(const Range& sorted_indices)
 {
-    if (new_size <= size_)
+    auto it = std::begin(sorted_indices);
+    const auto end = std::end(sorted_indices);
+    if (it == end)
     {
-        std::destroy_n(data_ + new_size, size_ - new_size);
-        size_ = new_size;
+        return;
     }
-    else
+    T* data = data_.GetAddress();
+    size_t kept = static_cast<size_t>(*it);
+    assert(kept < size_);
+    //    [first, last)   kept
+    const auto shift = [data, &kept](size_t first, size_t last) {
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+        {
+            detail::RelocateBytes(data + kept, data + first, last - first);
+        }
+        else
+        {
+            std::move(data + first, data + last, data + kept);
+        }
+        kept += last - first;
+    };
+    size_t removed = static_cast<size_t>(*it);
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
     {
-        size_t count_new_elem = new_size - size_;
-        if (Capacity() < new_size)
+        Destroy(data + removed);
+    }
+    for (++it; it != end; ++it)
+    {
+        const auto index = static_cast<size_t>(*it);
+        assert(index > removed && index < size_);
+        shift(removed + 1, index);
+        if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
         {
-            Reserve(new_size);
+            Destroy(data + index);
         }
-        std::uninitialized_value_construct_n(data_ + (Capacity() - count_new_elem), count_new_elem);
-        size_ = new_size;
+        removed = index;
     }
+    shift(removed + 1, size_);
+    if constexpr (!IS_TRIVIALLY_RELOCATABLE<T>)
+    {
+        std::destroy_n(data + kept, size_ - kept);
+    }
+    size_ = kept;
+    MaybeShrink();
 }
 
-template<typename T>
-inline void Vector<T>::PopBack() noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::PopBack() noexcept
 {
     Destroy(data_ + size_-1);
     --size_;
+    MaybeShrink();
 }
 
-template<typename T>
-inline T& Vector<T>::Back() noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline T& Vector<T, Allocator, GrowthPolicy, Instrumentation>::Back() noexcept
 {
     return data_[size_ - 1];
 }
 
-template<typename T>
-inline Vector<T>::~Vector()
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline Vector<T, Allocator, GrowthPolicy, Instrumentation>::~Vector()
 {
+    if constexpr (detail::HasOnDestroy<Instrumentation>)
+    {
+        Instrumentation::OnDestroy(size_);
+    }
     std::destroy_n(data_.GetAddress(), size_);
 }
 
-template<typename T>
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
 template<typename... Args>
-inline void Vector<T>::CopyConstruct(T* buf, Args&&... args)
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::CopyConstruct(T* buf, Args&&... args)
 {
-    new (buf) T((args)...);
+    detail::ForwardConstruct(buf, args...);
 }
 
-template<typename T>
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
 template<typename... Args>
-inline void Vector<T>::MoveConstruct(T* buf, Args&&... args)
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::MoveConstruct(T* buf, Args&&... args)
 {
-    new (buf) T(std::move(args)...);
+    detail::ForwardConstruct(buf, std::move(args)...);
 }
 
-template<typename T>
-inline void Vector<T>::Destroy(T* buf) noexcept
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::Destroy(T* buf) noexcept
 {
-    buf->~T();
+    detail::Destroy(buf);
 }
 
-template<typename T>
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
 template<typename V>
-inline void Vector<T>::PushBack(V&& value)
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::PushBack(V&& value)
+{
+    EmplaceBack(std::forward<V>(value));
+}
+
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename ...Args>
+inline T& Vector<T, Allocator, GrowthPolicy, Instrumentation>::EmplaceBack(Args && ...args)
 {
     if (size_ == Capacity())
     {
-        RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-        try
-        {
-            ForwardConstruct(new_data + size_, std::forward<V>(value));
-        }
-        catch (...)
+        const size_t new_capacity = GrowthCapacity(size_ + 1);
+        if (!TryExpand(new_capacity))
         {
-            Destroy(new_data + size_);
-            throw;
+            Instrumentation::OnGrow(Capacity(), new_capacity);
+            return *GrowAndEmplace(size_, new_capacity, std::forward<Args>(args)...);
         }
+    }
+    ForwardConstruct(data_ + size_, (std::forward<Args>(args))...);
+    ++size_;
+    return data_[size_ - 1];
+}
 
-        if constexpr (!std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>)
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+template<typename ...Args>
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ShiftAndConstruct(size_t pos, Args && ...args)
+{
+    assert(pos < size_ && size_ < Capacity());
+    T* gap = data_ + pos;
+    const size_t tail = size_ - pos;
+    if constexpr (IS_TRIVIALLY_RELOCATABLE<T>)
+    {
+        detail::RelocateBytes(gap + 1, gap, tail);
+        try
         {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+            ForwardConstruct(gap, std::forward<Args>(args)...);
         }
-        else
+        catch (...)
         {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+            detail::RelocateBytes(gap, gap + 1, tail);
+            throw;
         }
-        data_.Swap(new_data);
-        std::destroy_n(new_data.GetAddress(), size_);
     }
     else
     {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>);
+        ForwardConstruct(data_ + size_, std::move(data_[size_ - 1]));
+        std::move_backward(gap, data_ + (size_ - 1), data_ + size_);
+        Destroy(gap);
         try
         {
-            ForwardConstruct(data_ + size_, (std::forward<V>(value)));
+            ForwardConstruct(gap, std::forward<Args>(args)...);
         }
         catch (...)
         {
+            ForwardConstruct(gap, std::move(gap[1]));
+            std::move(gap + 2, data_ + (size_ + 1), gap + 1);
             Destroy(data_ + size_);
             throw;
         }
     }
-    ++size_;
 }
 
-template<typename T>
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
 template<typename ...Args>
-inline T& Vector<T>::EmplaceBack(Args && ...args)
+inline T* Vector<T, Allocator, GrowthPolicy, Instrumentation>::GrowAndEmplace(size_t pos, size_t new_capacity, Args && ...args)
 {
-    if (size_ == Capacity())
+    if constexpr (RawMemory<T, Allocator>::CAN_REALLOCATE)
     {
-        RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+        //      ,    
+        //     ,    
+        alignas(T) std::byte slot[sizeof(T)];
+        T* temp = reinterpret_cast<T*>(slot);
+        ForwardConstruct(temp, (std::forward<Args>(args))...);
         try
         {
-            ForwardConstruct(new_data + size_, (std::forward<Args>(args))...);
+            ReallocateBuffer(new_capacity);
         }
         catch (...)
         {
-            Destroy(new_data + size_);
+            Destroy(temp);
             throw;
         }
-
-        if constexpr (!std::is_copy_constructible_v<T> || std::is_nothrow_move_constructible_v<T>)
-        {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-        }
-        else
-        {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
-        }
-        data_.Swap(new_data);
-        std::destroy_n(new_data.GetAddress(), size_);
+        detail::RelocateBytes(data_ + pos + 1, data_ + pos, size_ - pos);
+        detail::RelocateBytes(data_ + pos, temp, 1);
     }
     else
     {
+        RawMemory<T, Allocator> new_data = AllocateBuffer(new_capacity);
+        ForwardConstruct(new_data + pos, (std::forward<Args>(args))...);
         try
         {
-            ForwardConstruct(data_ + size_, (std::forward<Args>(args))...);
+            RelocateTo(new_data, pos);
         }
         catch (...)
         {
-            Destroy(data_ + size_);
+            Destroy(new_data + pos);
             throw;
         }
     }
     ++size_;
-    return data_[size_ - 1];
+    return data_ + pos;
 }
 
-template<typename T>
+template<typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
 template<typename ...Args>
-inline void Vector<T>::ForwardConstruct(T* buf, Args && ...args)
+inline void Vector<T, Allocator, GrowthPolicy, Instrumentation>::ForwardConstruct(T* buf, Args && ...args)
 {
-    new (buf) T(std::forward<Args>(args)...);
-}
\ No newline at end of file
+    detail::ForwardConstruct(buf, std::forward<Args>(args)...);
+}
+
+// ,      std::pmr::memory_resource
+template <typename T, typename GrowthPolicy = DoublingGrowth, typename Instrumentation = NoInstrumentation>
+using PmrVector = Vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy, Instrumentation>;
@@ -0,0 +1,904 @@
+#pragma once
+#include "vector.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//     .      :      ,
+//         . ,    ,
+//     ,  ForEach       
+class ThreadPool
+{
+public:
+    // threads -     ; 0  std::thread::hardware_concurrency()
+    explicit ThreadPool(unsigned threads = 0)
+    {
+        const unsigned total = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+        queue_count_ = total;
+        queues_.reset(new Queue[queue_count_]);
+        try
+        {
+            workers_.reserve(total - 1);
+            for (size_t queue = 1; queue < queue_count_; ++queue)
+            {
+                workers_.emplace_back([this, queue] {
+                    WorkerLoop(queue);
+                    });
+            }
+        }
+        catch (...)
+        {
+            Stop();
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        Stop();
+    }
+
+    //  ,  ,  
+    unsigned Size() const noexcept
+    {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    //  body(i)   i  [0, count)     .
+    //        
+    template <typename Body>
+    void ForEach(size_t count, const Body& body)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        Group group;
+        group.pending.store(count, std::memory_order_relaxed);
+        const auto run = [](const void* context, size_t index) {
+            (*static_cast<const Body*>(context))(index);
+        };
+        size_t queued = 0;
+        if (!workers_.empty())
+        {
+            Queue& home = queues_[HomeQueue()];
+            std::lock_guard lock(home.mutex);
+            try
+            {
+                for (; queued + 1 < count; ++queued)
+                {
+                    home.tasks.push_back(Task{ run, &body, count - 1 - queued, &group });
+                }
+            }
+            catch (...)
+            {
+                // ,    ,   
+            }
+            queued_.fetch_add(queued, std::memory_order_relaxed);
+        }
+        if (queued != 0)
+        {
+            {
+                std::lock_guard lock(sleep_mutex_);
+            }
+            wake_.notify_all();
+        }
+        for (size_t index = 0; index + queued < count; ++index)
+        {
+            Run(Task{ run, &body, index, &group });
+        }
+        while (group.pending.load(std::memory_order_acquire) != 0)
+        {
+            if (!TryRunOne(HomeQueue()))
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (group.error)
+        {
+            std::rethrow_exception(group.error);
+        }
+    }
+
+    //  [0, count)     grain ,    ,
+    //   body(first, last)  
+    template <typename Body>
+    void ForEachRange(size_t count, size_t grain, const Body& body)
+    {
+        const size_t parts = Parts(count, grain);
+        ForEach(parts, [&body, count, parts](size_t part) {
+            body(detail::ChunkBegin(count, parts, part), detail::ChunkBegin(count, parts, part + 1));
+            });
+    }
+
+    //  ,   ForEachRange  count 
+    size_t Parts(size_t count, size_t grain) const noexcept
+    {
+        return std::max<size_t>(1, std::min<size_t>(count / std::max<size_t>(grain, 1), size_t{ Size() } * TASKS_PER_THREAD));
+    }
+
+    //     std::thread::hardware_concurrency() 
+    static ThreadPool& Default()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+private:
+    //  ,  ,       
+    static constexpr size_t TASKS_PER_THREAD = 4;
+
+    struct Group
+    {
+        std::atomic<size_t> pending{ 0 };
+        std::mutex error_mutex;
+        std::exception_ptr error;
+    };
+
+    struct Task
+    {
+        void (*run)(const void*, size_t);
+        const void* context;
+        size_t index;
+        Group* group;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    //   :     ,    
+    size_t HomeQueue() const noexcept
+    {
+        return CurrentPool() == this ? CurrentQueue() : 0;
+    }
+
+    static const ThreadPool*& CurrentPool() noexcept
+    {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& CurrentQueue() noexcept
+    {
+        thread_local size_t queue = 0;
+        return queue;
+    }
+
+    static void Run(const Task& task) noexcept
+    {
+        try
+        {
+            task.run(task.context, task.index);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(task.group->error_mutex);
+            if (!task.group->error)
+            {
+                task.group->error = std::current_exception();
+            }
+        }
+        //          
+        task.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    //   :        
+    bool TryRunOne(size_t home) noexcept
+    {
+        for (size_t offset = 0; offset < queue_count_; ++offset)
+        {
+            Queue& queue = queues_[(home + offset) % queue_count_];
+            std::unique_lock lock(queue.mutex);
+            if (queue.tasks.empty())
+            {
+                continue;
+            }
+            Task task;
+            if (offset == 0)
+            {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+            lock.unlock();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            Run(task);
+            return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(size_t home) noexcept
+    {
+        CurrentPool() = this;
+        CurrentQueue() = home;
+        while (true)
+        {
+            if (TryRunOne(home))
+            {
+                continue;
+            }
+            std::unique_lock lock(sleep_mutex_);
+            wake_.wait(lock, [this] {
+                return stop_ || queued_.load(std::memory_order_relaxed) != 0;
+                });
+            if (stop_ && queued_.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    void Stop() noexcept
+    {
+        {
+            std::lock_guard lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+        workers_.clear();
+    }
+
+    std::unique_ptr<Queue[]> queues_;
+    size_t queue_count_ = 0;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> queued_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+namespace detail
+{
+
+//    .         ,
+//         .    
+// (   ,   ,    ),  
+template <typename T>
+class ScratchBuffer
+{
+public:
+    explicit ScratchBuffer(size_t size)
+    {
+        Slot& slot = GetSlot();
+        if (slot.busy)
+        {
+            own_ = RawMemory<T>(size);
+            data_ = own_.GetAddress();
+            return;
+        }
+        if (slot.memory.Capacity() < size)
+        {
+            slot.memory = RawMemory<T>();
+            slot.memory = RawMemory<T>(size);
+        }
+        slot.busy = true;
+        slot_ = &slot;
+        data_ = slot.memory.GetAddress();
+    }
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    ~ScratchBuffer()
+    {
+        if (slot_)
+        {
+            slot_->busy = false;
+        }
+    }
+
+    T* Get() const noexcept
+    {
+        return data_;
+    }
+
+    //     
+    static void Release() noexcept
+    {
+        Slot& slot = GetSlot();
+        if (!slot.busy)
+        {
+            slot.memory = RawMemory<T>();
+        }
+    }
+
+private:
+    struct Slot
+    {
+        RawMemory<T> memory;
+        bool busy = false;
+    };
+
+    static Slot& GetSlot() noexcept
+    {
+        thread_local Slot slot;
+        return slot;
+    }
+
+    Slot* slot_ = nullptr;
+    RawMemory<T> own_;
+    T* data_ = nullptr;
+};
+
+//     
+inline constexpr size_t PARALLEL_SORT_MIN_SIZE = 16 * 1024;
+//       
+inline constexpr size_t PARALLEL_GRAIN = 8 * 1024;
+
+template <typename T>
+concept RadixSortable = (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    || (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+template <typename T, typename Compare>
+concept RadixSortableWith = RadixSortable<T> && (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>);
+
+template <size_t Size>
+using UnsignedOfSize = std::conditional_t<Size == 1, uint8_t,
+    std::conditional_t<Size == 2, uint16_t, std::conditional_t<Size == 4, uint32_t, uint64_t>>>;
+
+//  ,      :    
+//  ,       -  ,   - 
+template <RadixSortable T>
+UnsignedOfSize<sizeof(T)> RadixKey(T value) noexcept
+{
+    using Key = UnsignedOfSize<sizeof(T)>;
+    constexpr Key SIGN = static_cast<Key>(Key{ 1 } << (sizeof(Key) * 8 - 1));
+    const Key bits = std::bit_cast<Key>(value);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return (bits & SIGN) != 0 ? static_cast<Key>(~bits) : static_cast<Key>(bits | SIGN);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<Key>(bits ^ SIGN);
+    }
+    else
+    {
+        return bits;
+    }
+}
+
+inline constexpr unsigned RADIX_BITS = 8;
+inline constexpr size_t RADIX_SIZE = size_t{ 1 } << RADIX_BITS;
+
+using RadixHistogram = std::array<size_t, RADIX_SIZE>;
+
+//     .       ,
+//        ,     .
+// ,       , 
+template <RadixSortable T>
+void RadixSort(ThreadPool& pool, T* data, size_t size)
+{
+    constexpr unsigned PASSES = sizeof(T);
+    //        ,    ,  :
+    //        TLB
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(pool.Size(), size / PARALLEL_GRAIN));
+    const auto part_begin = [size, parts](size_t part) {
+        return ChunkBegin(size, parts, part);
+    };
+
+    //        ,     
+    std::vector<std::array<RadixHistogram, PASSES>> part_totals(parts);
+    pool.ForEach(parts, [&](size_t part) {
+        std::array<RadixHistogram, PASSES> histograms{};
+        const T* last = data + part_begin(part + 1);
+        for (const T* it = data + part_begin(part); it != last; ++it)
+        {
+            const auto key = RadixKey(*it);
+            for (unsigned pass = 0; pass < PASSES; ++pass)
+            {
+                ++histograms[pass][(key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)];
+            }
+        }
+        part_totals[part] = histograms;
+        });
+
+    ScratchBuffer<T> scratch(size);
+    T* from = data;
+    T* to = scratch.Get();
+    std::vector<RadixHistogram> offsets(parts);
+    bool moved = false;
+    for (unsigned pass = 0; pass < PASSES; ++pass)
+    {
+        const unsigned shift = pass * RADIX_BITS;
+        RadixHistogram total{};
+        for (const auto& histograms : part_totals)
+        {
+            for (size_t digit = 0; digit < RADIX_SIZE; ++digit)
+            {
+                total[digit] += histograms[pass][digit];
+            }
+        }
+        if (std::find(total.begin(), total.end(), size) != total.end())
+        {
+            continue;
+        }
+        //       ,      .
+        //      
+        pool.ForEach(parts, [&](size_t part) {
+            RadixHistogram& histogram = offsets[part];
+            if (!moved || parts == 1)
+            {
+                histogram = part_totals[part][pass];
+                return;
+            }
+            RadixHistogram counts{};
+            const T* last = from + part_begin(part + 1);
+            for (const T* it = from + part_begin(part); it != last; ++it)
+            {
+                ++counts[(RadixKey(*it) >> shift) & (RADIX_SIZE - 1)];
+            }
+            histogram = counts;
+            });
+        size_t position = 0;
+        for (size_t digit = 0; digit < RADIX_SIZE; ++digit)
+        {
+            for (size_t part = 0; part < parts; ++part)
+            {
+                const size_t count = offsets[part][digit];
+                offsets[part][digit] = position;
+                position += count;
+            }
+        }
+        pool.ForEach(parts, [&](size_t part) {
+            //   :  ,    to   
+            RadixHistogram next = offsets[part];
+            const T* last = from + part_begin(part + 1);
+            for (const T* it = from + part_begin(part); it != last; ++it)
+            {
+                to[next[(RadixKey(*it) >> shift) & (RADIX_SIZE - 1)]++] = *it;
+            }
+            });
+        std::swap(from, to);
+        moved = true;
+    }
+    if (from != data)
+    {
+        pool.ForEachRange(size, PARALLEL_GRAIN, [from, data](size_t first, size_t last) {
+            std::memcpy(data + first, from + first, (last - first) * sizeof(T));
+            });
+    }
+}
+
+//   a,    diagonal   a  b.      a
+template <typename T, typename Compare>
+size_t MergePath(const T* a, size_t a_size, const T* b, size_t b_size, size_t diagonal, Compare& comp)
+{
+    size_t low = diagonal > b_size ? diagonal - b_size : 0;
+    size_t high = std::min(diagonal, a_size);
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+        if (comp(b[diagonal - middle - 1], a[middle]))
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
+//  :   std::sort,     
+//    .       ,   ,
+//   ,    
+template <typename T, typename Compare>
+void MergeSort(ThreadPool& pool, T* data, size_t size, Compare& comp)
+{
+    const size_t parts = pool.Parts(size, PARALLEL_GRAIN);
+    std::vector<size_t> runs(parts + 1);
+    for (size_t part = 0; part <= parts; ++part)
+    {
+        runs[part] = ChunkBegin(size, parts, part);
+    }
+    pool.ForEach(parts, [&](size_t part) {
+        std::sort(data + runs[part], data + runs[part + 1], comp);
+        });
+    if (parts == 1)
+    {
+        return;
+    }
+
+    ScratchBuffer<T> scratch(size);
+    T* buffer = scratch.Get();
+    //            ,
+    //     
+    struct Elements
+    {
+        T* data = nullptr;
+        size_t size = 0;
+        ~Elements()
+        {
+            std::destroy_n(data, size);
+        }
+    } elements;
+    if constexpr (!std::is_trivially_copyable_v<T>)
+    {
+        std::unique_ptr<bool[]> moved(new bool[parts]());
+        try
+        {
+            pool.ForEach(parts, [&](size_t part) {
+                std::uninitialized_move(data + runs[part], data + runs[part + 1], buffer + runs[part]);
+                moved[part] = true;
+                });
+        }
+        catch (...)
+        {
+            for (size_t part = 0; part < parts; ++part)
+            {
+                if (moved[part])
+                {
+                    std::destroy(buffer + runs[part], buffer + runs[part + 1]);
+                }
+            }
+            throw;
+        }
+        elements.data = buffer;
+        elements.size = size;
+    }
+
+    struct MergeTask
+    {
+        size_t first;       //   
+        size_t middle;      //   
+        size_t last;
+        size_t from;        //   
+        size_t to;
+        size_t a_from;      //   ,    
+        size_t a_to;
+    };
+    //      
+    T* from = elements.data != nullptr ? buffer : data;
+    T* to = elements.data != nullptr ? data : buffer;
+    std::vector<MergeTask> tasks;
+    while (runs.size() > 2)
+    {
+        tasks.clear();
+        std::vector<size_t> merged;
+        for (size_t run = 0; run + 1 < runs.size(); run += 2)
+        {
+            const size_t first = runs[run];
+            const size_t middle = runs[run + 1];
+            const size_t last = run + 2 < runs.size() ? runs[run + 2] : middle;
+            const size_t length = last - first;
+            const size_t pieces = std::max<size_t>(1, length * parts / size);
+            for (size_t piece = 0; piece < pieces; ++piece)
+            {
+                tasks.push_back(MergeTask{ first, middle, last, ChunkBegin(length, pieces, piece), ChunkBegin(length, pieces, piece + 1), 0, 0 });
+            }
+            merged.push_back(first);
+        }
+        merged.push_back(size);
+        //     :       
+        pool.ForEach(tasks.size(), [&, from](size_t index) {
+            MergeTask& task = tasks[index];
+            const T* a = from + task.first;
+            const T* b = from + task.middle;
+            const size_t a_size = task.middle - task.first;
+            const size_t b_size = task.last - task.middle;
+            task.a_from = MergePath(a, a_size, b, b_size, task.from, comp);
+            task.a_to = MergePath(a, a_size, b, b_size, task.to, comp);
+            });
+        pool.ForEach(tasks.size(), [&, from, to](size_t index) {
+            const MergeTask& task = tasks[index];
+            std::merge(std::make_move_iterator(from + task.first + task.a_from),
+                std::make_move_iterator(from + task.first + task.a_to),
+                std::make_move_iterator(from + task.middle + (task.from - task.a_from)),
+                std::make_move_iterator(from + task.middle + (task.to - task.a_to)), to + task.first + task.from, comp);
+            });
+        runs = std::move(merged);
+        std::swap(from, to);
+    }
+    if (from != data)
+    {
+        pool.ForEachRange(size, PARALLEL_GRAIN, [from, data](size_t first, size_t last) {
+            std::move(from + first, from + last, data + first);
+            });
+    }
+}
+
+//   [first[i], last[i])  dest  emit(dest, element),   
+//     
+template <typename T, typename Compare, typename Emit>
+void MultiwayMerge(std::vector<std::pair<const T*, const T*>>& ranges, T* dest, Compare& comp, const Emit& emit)
+{
+    std::erase_if(ranges, [](const auto& range) {
+        return range.first == range.second;
+        });
+    if (ranges.size() == 1)
+    {
+        for (const T* it = ranges[0].first; it != ranges[0].second; ++it)
+        {
+            emit(dest++, *it);
+        }
+        return;
+    }
+    //   :      
+    std::vector<size_t> heap(ranges.size());
+    for (size_t i = 0; i < heap.size(); ++i)
+    {
+        heap[i] = i;
+    }
+    const auto later = [&ranges, &comp](size_t lhs, size_t rhs) {
+        const T& a = *ranges[lhs].first;
+        const T& b = *ranges[rhs].first;
+        return comp(b, a) || (!comp(a, b) && lhs > rhs);
+    };
+    std::make_heap(heap.begin(), heap.end(), later);
+    while (!heap.empty())
+    {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        auto& range = ranges[heap.back()];
+        emit(dest++, *range.first);
+        if (++range.first == range.second)
+        {
+            heap.pop_back();
+        }
+        else
+        {
+            std::push_heap(heap.begin(), heap.end(), later);
+        }
+    }
+}
+
+} // namespace detail
+
+//   v  comp   .       
+//   std::less  ,   -   .
+//           .
+// comp     .  .  comp  ,   ,     
+template <typename T, typename A, typename G, typename I, typename Compare = std::less<>>
+void ParallelSort(ThreadPool& pool, Vector<T, A, G, I>& v, Compare comp = Compare())
+{
+    T* data = v.begin();
+    const size_t size = v.Size();
+    if (size < detail::PARALLEL_SORT_MIN_SIZE)
+    {
+        std::sort(data, data + size, comp);
+    }
+    else if constexpr (detail::RadixSortableWith<T, Compare>)
+    {
+        detail::RadixSort(pool, data, size);
+    }
+    else
+    {
+        detail::MergeSort(pool, data, size, comp);
+    }
+}
+
+//    comp  (   ,  Vector)  out, 
+//  .      -,   ,  
+//  .  :         .
+//       ,    out.
+// out      
+template <typename Inputs, typename T, typename A, typename G, typename I, typename Compare = std::less<>>
+void ParallelMerge(ThreadPool& pool, const Inputs& inputs, Vector<T, A, G, I>& out, Compare comp = Compare())
+{
+    std::vector<std::pair<const T*, const T*>> ranges;
+    size_t total = 0;
+    for (const auto& input : inputs)
+    {
+        const T* first = std::ranges::data(input);
+        ranges.emplace_back(first, first + std::ranges::size(input));
+        total += std::ranges::size(input);
+    }
+    const size_t parts = pool.Parts(total, detail::PARALLEL_GRAIN);
+
+    //  -    ,   
+    std::vector<const T*> samples;
+    if (parts > 1)
+    {
+        const size_t SAMPLES_PER_PART = 16;
+        for (const auto& [first, last] : ranges)
+        {
+            const size_t size = last - first;
+            const size_t count = (size * parts * SAMPLES_PER_PART + total - 1) / total;
+            for (size_t i = 0; i < count; ++i)
+            {
+                samples.push_back(first + size * i / count);
+            }
+        }
+        std::sort(samples.begin(), samples.end(), [&comp](const T* lhs, const T* rhs) {
+            return comp(*lhs, *rhs);
+            });
+    }
+    //   part   input:     
+    const auto bound = [&](size_t part, size_t input) -> const T* {
+        const auto [first, last] = ranges[input];
+        if (part == 0)
+        {
+            return first;
+        }
+        if (part == parts)
+        {
+            return last;
+        }
+        return std::lower_bound(first, last, *samples[samples.size() * part / parts], comp);
+    };
+    const auto merge_part = [&](size_t part, T* dest, const auto& emit) {
+        std::vector<std::pair<const T*, const T*>> pieces(ranges.size());
+        size_t offset = 0;
+        for (size_t input = 0; input < ranges.size(); ++input)
+        {
+            pieces[input] = { bound(part, input), bound(part + 1, input) };
+            offset += pieces[input].first - ranges[input].first;
+        }
+        const size_t count = std::transform_reduce(pieces.begin(), pieces.end(), size_t{ 0 }, std::plus<>(),
+            [](const auto& piece) {
+                return static_cast<size_t>(piece.second - piece.first);
+            });
+        detail::MultiwayMerge(pieces, dest + offset, comp, emit);
+        return std::pair{ offset, count };
+    };
+
+    if constexpr (std::is_default_constructible_v<T> && std::is_copy_assignable_v<T>)
+    {
+        out.Clear();
+        out.ResizeAndOverwrite(total, [&](T* dest, size_t size) {
+            pool.ForEach(parts, [&](size_t part) {
+                merge_part(part, dest, [](T* to, const T& value) {
+                    *to = value;
+                    });
+                });
+            return size;
+            });
+    }
+    else
+    {
+        //         ,    
+        //    
+        RawMemory<T, A> memory(total, out.GetAllocator());
+        T* dest = memory.GetAddress();
+        std::unique_ptr<std::pair<size_t, size_t>[]> done(new std::pair<size_t, size_t>[parts]());
+        try
+        {
+            pool.ForEach(parts, [&](size_t part) {
+                T* next = nullptr;
+                T* begin = nullptr;
+                try
+                {
+                    done[part] = merge_part(part, dest, [&next, &begin](T* to, const T& value) {
+                        if (begin == nullptr)
+                        {
+                            begin = next = to;
+                        }
+                        std::construct_at(to, value);
+                        next = to + 1;
+                        });
+                }
+                catch (...)
+                {
+                    std::destroy(begin, next);
+                    throw;
+                }
+                });
+        }
+        catch (...)
+        {
+            for (size_t part = 0; part < parts; ++part)
+            {
+                std::destroy_n(dest + done[part].first, done[part].second);
+            }
+            throw;
+        }
+        out = Vector<T, A, G, I>(std::move(memory), total);
+    }
+}
+
+namespace detail
+{
+
+//   op    [0, parts - 1)  data.     
+template <typename T, typename BinaryOp>
+std::vector<std::optional<T>> PartTotals(ThreadPool& pool, const T* data, size_t size, size_t parts, BinaryOp& op)
+{
+    std::vector<std::optional<T>> totals(parts - 1);
+    pool.ForEach(parts - 1, [&](size_t part) {
+        const T* first = data + ChunkBegin(size, parts, part);
+        totals[part].emplace(std::accumulate(first + 1, data + ChunkBegin(size, parts, part + 1), *first, op));
+        });
+    return totals;
+}
+
+} // namespace detail
+
+//   v     op: v[i] = v[0] op ... op v[i].
+//    ,       .
+// op         
+template <typename T, typename A, typename G, typename I, typename BinaryOp = std::plus<>>
+void ParallelInclusiveScan(ThreadPool& pool, Vector<T, A, G, I>& v, BinaryOp op = BinaryOp())
+{
+    T* data = v.begin();
+    const size_t size = v.Size();
+    const size_t parts = pool.Parts(size, detail::PARALLEL_GRAIN);
+    if (parts == 1)
+    {
+        std::inclusive_scan(data, data + size, data, op);
+        return;
+    }
+    std::vector<std::optional<T>> offsets = detail::PartTotals(pool, data, size, parts, op);
+    for (size_t part = 1; part + 1 < parts; ++part)
+    {
+        offsets[part] = op(*offsets[part - 1], *offsets[part]);
+    }
+    pool.ForEach(parts, [&](size_t part) {
+        T* first = data + detail::ChunkBegin(size, parts, part);
+        T* last = data + detail::ChunkBegin(size, parts, part + 1);
+        if (part == 0)
+        {
+            std::inclusive_scan(first, last, first, op);
+        }
+        else
+        {
+            std::inclusive_scan(first, last, first, op, *offsets[part - 1]);
+        }
+        });
+}
+
+//   v   : v[i] = init op v[0] op ... op v[i - 1]
+template <typename T, typename A, typename G, typename I, typename BinaryOp = std::plus<>>
+void ParallelExclusiveScan(ThreadPool& pool, Vector<T, A, G, I>& v, T init, BinaryOp op = BinaryOp())
+{
+    T* data = v.begin();
+    const size_t size = v.Size();
+    const size_t parts = pool.Parts(size, detail::PARALLEL_GRAIN);
+    if (parts == 1)
+    {
+        std::exclusive_scan(data, data + size, data, std::move(init), op);
+        return;
+    }
+    std::vector<std::optional<T>> offsets = detail::PartTotals(pool, data, size, parts, op);
+    offsets[0] = op(init, *offsets[0]);
+    for (size_t part = 1; part + 1 < parts; ++part)
+    {
+        offsets[part] = op(*offsets[part - 1], *offsets[part]);
+    }
+    pool.ForEach(parts, [&](size_t part) {
+        T* first = data + detail::ChunkBegin(size, parts, part);
+        T* last = data + detail::ChunkBegin(size, parts, part + 1);
+        std::exclusive_scan(first, last, first, part == 0 ? init : *offsets[part - 1], op);
+        });
+}
+
+//       T,   
+template <typename T>
+void ReleaseAlgorithmScratch() noexcept
+{
+    detail::ScratchBuffer<T>::Release();
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include "vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+//   
+struct VectorStats
+{
+    size_t allocations = 0;
+    size_t bytes_allocated = 0;
+    size_t growth_reallocations = 0;
+    size_t in_place_expansions = 0;
+    size_t bytes_expanded = 0;
+    size_t elements_relocated = 0;
+    size_t elements_moved = 0;
+    size_t elements_copied = 0;
+    size_t peak_capacity = 0;
+};
+
+//    CountingInstrumentation,     
+class VectorStatsRegistry
+{
+public:
+    using SnapshotFn = VectorStats (*)();
+
+    //  visitor(name, stats)    
+    template <typename Visitor>
+    static void ForEach(Visitor&& visitor)
+    {
+        std::vector<Entry> entries;
+        {
+            std::lock_guard lock(Mutex());
+            entries = Entries();
+        }
+        for (const Entry& entry : entries)
+        {
+            visitor(entry.name, entry.snapshot());
+        }
+    }
+
+    static void Register(std::string_view name, SnapshotFn snapshot)
+    {
+        std::lock_guard lock(Mutex());
+        Entries().push_back(Entry{ name, snapshot });
+    }
+
+private:
+    struct Entry
+    {
+        std::string_view name;
+        SnapshotFn snapshot;
+    };
+
+    static std::mutex& Mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<Entry>& Entries()
+    {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+};
+
+namespace detail
+{
+
+template <typename Tag, typename = void>
+struct TagName
+{
+    static std::string_view Get()
+    {
+        return typeid(Tag).name();
+    }
+};
+
+template <typename Tag>
+struct TagName<Tag, std::void_t<decltype(Tag::NAME)>>
+{
+    static std::string_view Get()
+    {
+        return Tag::NAME;
+    }
+};
+
+} // namespace detail
+
+//        Tag.
+//         ;    Tag::NAME,   .
+//    relaxed-:       
+template <typename Tag>
+class CountingInstrumentation
+{
+public:
+    static void OnAllocate(size_t capacity, size_t bytes) noexcept
+    {
+        EnsureRegistered();
+        Counters& c = Get();
+        c.allocations.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+        UpdatePeak(capacity);
+    }
+
+    static void OnExpand(size_t /*old_capacity*/, size_t new_capacity, size_t bytes) noexcept
+    {
+        EnsureRegistered();
+        Counters& c = Get();
+        c.in_place_expansions.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_expanded.fetch_add(bytes, std::memory_order_relaxed);
+        UpdatePeak(new_capacity);
+    }
+
+    static void OnGrow(size_t /*old_capacity*/, size_t /*new_capacity*/) noexcept
+    {
+        EnsureRegistered();
+        Get().growth_reallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void OnRelocate(size_t bitwise, size_t moved, size_t copied) noexcept
+    {
+        EnsureRegistered();
+        Counters& c = Get();
+        c.elements_relocated.fetch_add(bitwise, std::memory_order_relaxed);
+        c.elements_moved.fetch_add(moved, std::memory_order_relaxed);
+        c.elements_copied.fetch_add(copied, std::memory_order_relaxed);
+    }
+
+    static VectorStats Snapshot() noexcept
+    {
+        const Counters& c = Get();
+        VectorStats stats;
+        stats.allocations = c.allocations.load(std::memory_order_relaxed);
+        stats.bytes_allocated = c.bytes_allocated.load(std::memory_order_relaxed);
+        stats.growth_reallocations = c.growth_reallocations.load(std::memory_order_relaxed);
+        stats.in_place_expansions = c.in_place_expansions.load(std::memory_order_relaxed);
+        stats.bytes_expanded = c.bytes_expanded.load(std::memory_order_relaxed);
+        stats.elements_relocated = c.elements_relocated.load(std::memory_order_relaxed);
+        stats.elements_moved = c.elements_moved.load(std::memory_order_relaxed);
+        stats.elements_copied = c.elements_copied.load(std::memory_order_relaxed);
+        stats.peak_capacity = c.peak_capacity.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    static void Reset() noexcept
+    {
+        Counters& c = Get();
+        c.allocations.store(0, std::memory_order_relaxed);
+        c.bytes_allocated.store(0, std::memory_order_relaxed);
+        c.growth_reallocations.store(0, std::memory_order_relaxed);
+        c.in_place_expansions.store(0, std::memory_order_relaxed);
+        c.bytes_expanded.store(0, std::memory_order_relaxed);
+        c.elements_relocated.store(0, std::memory_order_relaxed);
+        c.elements_moved.store(0, std::memory_order_relaxed);
+        c.elements_copied.store(0, std::memory_order_relaxed);
+        c.peak_capacity.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct Counters
+    {
+        std::atomic<size_t> allocations{ 0 };
+        std::atomic<size_t> bytes_allocated{ 0 };
+        std::atomic<size_t> growth_reallocations{ 0 };
+        std::atomic<size_t> in_place_expansions{ 0 };
+        std::atomic<size_t> bytes_expanded{ 0 };
+        std::atomic<size_t> elements_relocated{ 0 };
+        std::atomic<size_t> elements_moved{ 0 };
+        std::atomic<size_t> elements_copied{ 0 };
+        std::atomic<size_t> peak_capacity{ 0 };
+    };
+
+    static Counters& Get() noexcept
+    {
+        static Counters counters;
+        return counters;
+    }
+
+    static void UpdatePeak(size_t capacity) noexcept
+    {
+        Counters& c = Get();
+        size_t peak = c.peak_capacity.load(std::memory_order_relaxed);
+        while (peak < capacity && !c.peak_capacity.compare_exchange_weak(peak, capacity, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    //     ;     
+    //      ,        
+    static void EnsureRegistered() noexcept
+    {
+        static const bool registered = [] {
+            try
+            {
+                VectorStatsRegistry::Register(detail::TagName<Tag>::Get(), &Snapshot);
+                return true;
+            }
+            catch (...)
+            {
+                return false;
+            }
+        }();
+        (void)registered;
+    }
+};
+
+// ,     Tag
+template <typename T, typename Tag = T, typename Allocator = std::allocator<T>, typename GrowthPolicy = DoublingGrowth>
+using InstrumentedVector = Vector<T, Allocator, GrowthPolicy, CountingInstrumentation<Tag>>;
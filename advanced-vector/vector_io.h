@@ -0,0 +1,465 @@
+#pragma once
+#include "vector.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+//  Vector     .
+//      (, ,  ,  ).
+//       :  -  writev 
+//  ,  -    ,     .
+//     VectorCodec<T>       
+// ,      .      
+//  ,      .
+//       ,    
+
+//    :
+//   static void Encode(VectorWriter& out, const T& value);
+//   static T Decode(VectorReader& in);
+template <typename T>
+struct VectorCodec;
+
+//     CHUNK_SIZE 
+class VectorWriter
+{
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    using SinkFn = void (*)(void* sink, const void* data, size_t size);
+
+    VectorWriter(void* sink, SinkFn write)
+        : sink_(sink)
+        , write_(write)
+        , buffer_(CHUNK_SIZE, default_init)
+    {
+    }
+
+    VectorWriter(const VectorWriter&) = delete;
+    VectorWriter& operator=(const VectorWriter&) = delete;
+
+    void Write(const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const char*>(data);
+        while (size != 0)
+        {
+            const size_t n = std::min(size, CHUNK_SIZE - used_);
+            std::memcpy(buffer_.begin() + used_, bytes, n);
+            used_ += n;
+            bytes += n;
+            size -= n;
+            if (used_ == CHUNK_SIZE)
+            {
+                Flush();
+            }
+        }
+    }
+
+    template <typename U>
+        requires std::is_trivially_copyable_v<U>
+    void Write(const U& value)
+    {
+        Write(&value, sizeof(U));
+    }
+
+    //   
+    void Flush()
+    {
+        if (used_ != 0)
+        {
+            const auto length = static_cast<uint32_t>(used_);
+            write_(sink_, &length, sizeof(length));
+            write_(sink_, buffer_.begin(), used_);
+            used_ = 0;
+        }
+    }
+
+private:
+    void* sink_;
+    SinkFn write_;
+    Vector<char> buffer_;
+    size_t used_ = 0;
+};
+
+//  ,  VectorWriter
+class VectorReader
+{
+public:
+    //   size    
+    using SourceFn = void (*)(void* source, void* data, size_t size);
+
+    VectorReader(void* source, SourceFn read)
+        : source_(source)
+        , read_(read)
+        , buffer_(VectorWriter::CHUNK_SIZE, default_init)
+    {
+    }
+
+    VectorReader(const VectorReader&) = delete;
+    VectorReader& operator=(const VectorReader&) = delete;
+
+    void Read(void* data, size_t size)
+    {
+        auto* bytes = static_cast<char*>(data);
+        while (size != 0)
+        {
+            if (position_ == available_)
+            {
+                NextChunk();
+            }
+            const size_t n = std::min(size, available_ - position_);
+            std::memcpy(bytes, buffer_.begin() + position_, n);
+            position_ += n;
+            bytes += n;
+            size -= n;
+        }
+    }
+
+    template <typename U>
+        requires std::is_trivially_copyable_v<U> && std::is_default_constructible_v<U>
+    U Read()
+    {
+        U value;
+        Read(&value, sizeof(U));
+        return value;
+    }
+
+    //      
+    bool AtChunkEnd() const noexcept
+    {
+        return position_ == available_;
+    }
+
+private:
+    void NextChunk()
+    {
+        uint32_t length = 0;
+        read_(source_, &length, sizeof(length));
+        if (length == 0 || length > VectorWriter::CHUNK_SIZE)
+        {
+            throw std::runtime_error("Vector stream: corrupted chunk");
+        }
+        read_(source_, buffer_.begin(), length);
+        position_ = 0;
+        available_ = length;
+    }
+
+    void* source_;
+    SourceFn read_;
+    Vector<char> buffer_;
+    size_t position_ = 0;
+    size_t available_ = 0;
+};
+
+template <typename Char, typename Traits, typename Alloc>
+struct VectorCodec<std::basic_string<Char, Traits, Alloc>>
+{
+    using String = std::basic_string<Char, Traits, Alloc>;
+
+    static void Encode(VectorWriter& out, const String& value)
+    {
+        out.Write(static_cast<uint64_t>(value.size()));
+        out.Write(value.data(), value.size() * sizeof(Char));
+    }
+
+    static String Decode(VectorReader& in)
+    {
+        const auto size = in.Read<uint64_t>();
+        String value;
+        //      ,        
+        Char chunk[256];
+        for (uint64_t left = size; left != 0;)
+        {
+            const auto n = static_cast<size_t>(std::min<uint64_t>(left, std::size(chunk)));
+            in.Read(chunk, n * sizeof(Char));
+            value.append(chunk, n);
+            left -= n;
+        }
+        return value;
+    }
+};
+
+namespace detail::io
+{
+
+template <typename T>
+concept HasCodec = requires(VectorWriter& out, VectorReader& in, const T& value)
+{
+    VectorCodec<T>::Encode(out, value);
+    { VectorCodec<T>::Decode(in) } -> std::convertible_to<T>;
+};
+
+//      
+template <typename T>
+inline constexpr uint32_t ELEMENT_SIZE = HasCodec<T> ? 0 : static_cast<uint32_t>(sizeof(T));
+
+struct Header
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t count;
+};
+
+inline constexpr uint64_t MAGIC = 0x4d52545343455656ull; // "VVECSTRM"
+inline constexpr uint32_t VERSION = 1;
+
+template <typename T>
+inline Header MakeHeader(size_t count) noexcept
+{
+    return Header{ MAGIC, VERSION, ELEMENT_SIZE<T>, count };
+}
+
+template <typename T>
+inline size_t CheckHeader(const Header& header)
+{
+    if (header.magic != MAGIC || header.version != VERSION)
+    {
+        throw std::runtime_error("Vector stream: bad header");
+    }
+    if (header.element_size != ELEMENT_SIZE<T>)
+    {
+        throw std::runtime_error("Vector stream: element type mismatch");
+    }
+    if (header.count > std::numeric_limits<size_t>::max() / sizeof(T))
+    {
+        throw std::length_error("Vector stream: too many elements");
+    }
+    return static_cast<size_t>(header.count);
+}
+
+[[noreturn]] inline void ThrowSystemError(const char* operation)
+{
+    throw std::system_error(errno, std::generic_category(), operation);
+}
+
+//   ,  writev      
+inline void WriteAll(int fd, iovec* iov, int count)
+{
+    while (count != 0)
+    {
+        const ssize_t written = writev(fd, iov, std::min(count, IOV_MAX));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            ThrowSystemError("writev");
+        }
+        auto left = static_cast<size_t>(written);
+        for (; count != 0 && left >= iov->iov_len; ++iov, --count)
+        {
+            left -= iov->iov_len;
+        }
+        if (count != 0)
+        {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+}
+
+inline void ReadAll(int fd, void* data, size_t size)
+{
+    auto* bytes = static_cast<char*>(data);
+    while (size != 0)
+    {
+        const ssize_t received = read(fd, bytes, size);
+        if (received < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            ThrowSystemError("read");
+        }
+        if (received == 0)
+        {
+            throw std::runtime_error("Vector stream: unexpected end of data");
+        }
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+}
+
+inline void WriteAll(std::ostream& out, const void* data, size_t size)
+{
+    if (!out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)))
+    {
+        throw std::runtime_error("Vector stream: write failed");
+    }
+}
+
+inline void ReadAll(std::istream& in, void* data, size_t size)
+{
+    if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size)))
+    {
+        throw std::runtime_error("Vector stream: unexpected end of data");
+    }
+}
+
+inline void WriteToFd(void* fd, const void* data, size_t size)
+{
+    iovec iov{ const_cast<void*>(data), size };
+    WriteAll(*static_cast<int*>(fd), &iov, 1);
+}
+
+inline void ReadFromFd(void* fd, void* data, size_t size)
+{
+    ReadAll(*static_cast<int*>(fd), data, size);
+}
+
+inline void WriteToStream(void* out, const void* data, size_t size)
+{
+    WriteAll(*static_cast<std::ostream*>(out), data, size);
+}
+
+inline void ReadFromStream(void* in, void* data, size_t size)
+{
+    ReadAll(*static_cast<std::istream*>(in), data, size);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Encode(VectorWriter& out, const Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    for (const T& value : v)
+    {
+        VectorCodec<T>::Encode(out, value);
+    }
+    out.Flush();
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+inline void Decode(VectorReader& in, size_t count, Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    //        :      
+    v.Reserve(std::min(count, VectorWriter::CHUNK_SIZE / sizeof(T)));
+    try
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            v.EmplaceBack(VectorCodec<T>::Decode(in));
+        }
+        if (!in.AtChunkEnd())
+        {
+            throw std::runtime_error("Vector stream: trailing data in chunk");
+        }
+    }
+    catch (...)
+    {
+        v.Clear();
+        throw;
+    }
+}
+
+} // namespace detail::io
+
+//     .     std::system_error
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+void WriteTo(int fd, const Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    static_assert(detail::io::HasCodec<T> || std::is_trivially_copyable_v<T>,
+        "Specialize VectorCodec<T> for types that are not trivially copyable");
+    detail::io::Header header = detail::io::MakeHeader<T>(v.Size());
+    if constexpr (detail::io::HasCodec<T>)
+    {
+        iovec iov{ &header, sizeof(header) };
+        detail::io::WriteAll(fd, &iov, 1);
+        VectorWriter out(&fd, &detail::io::WriteToFd);
+        detail::io::Encode(out, v);
+    }
+    else
+    {
+        iovec iov[2] = {
+            { &header, sizeof(header) },
+            { const_cast<T*>(v.begin()), v.Size() * sizeof(T) },
+        };
+        detail::io::WriteAll(fd, iov, 2);
+    }
+}
+
+//       .
+//     (std::runtime_error);     
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+void ReadFrom(int fd, Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    static_assert(detail::io::HasCodec<T> || std::is_trivially_copyable_v<T>,
+        "Specialize VectorCodec<T> for types that are not trivially copyable");
+    v.Clear();
+    detail::io::Header header{};
+    detail::io::ReadAll(fd, &header, sizeof(header));
+    const size_t count = detail::io::CheckHeader<T>(header);
+    if constexpr (detail::io::HasCodec<T>)
+    {
+        VectorReader in(&fd, &detail::io::ReadFromFd);
+        detail::io::Decode(in, count, v);
+    }
+    else
+    {
+        v.Reserve(count);
+        v.ResizeAndOverwrite(count, [fd](T* data, size_t n) {
+            detail::io::ReadAll(fd, data, n * sizeof(T));
+            return n;
+        });
+    }
+}
+
+//    .     std::runtime_error
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+void WriteTo(std::ostream& out, const Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    static_assert(detail::io::HasCodec<T> || std::is_trivially_copyable_v<T>,
+        "Specialize VectorCodec<T> for types that are not trivially copyable");
+    const detail::io::Header header = detail::io::MakeHeader<T>(v.Size());
+    detail::io::WriteAll(out, &header, sizeof(header));
+    if constexpr (detail::io::HasCodec<T>)
+    {
+        VectorWriter writer(&out, &detail::io::WriteToStream);
+        detail::io::Encode(writer, v);
+    }
+    else
+    {
+        detail::io::WriteAll(out, v.begin(), v.Size() * sizeof(T));
+    }
+}
+
+//      ;     ,   ReadFrom(int, ...)
+template <typename T, typename Allocator, typename GrowthPolicy, typename Instrumentation>
+void ReadFrom(std::istream& in, Vector<T, Allocator, GrowthPolicy, Instrumentation>& v)
+{
+    static_assert(detail::io::HasCodec<T> || std::is_trivially_copyable_v<T>,
+        "Specialize VectorCodec<T> for types that are not trivially copyable");
+    v.Clear();
+    detail::io::Header header{};
+    detail::io::ReadAll(in, &header, sizeof(header));
+    const size_t count = detail::io::CheckHeader<T>(header);
+    if constexpr (detail::io::HasCodec<T>)
+    {
+        VectorReader reader(&in, &detail::io::ReadFromStream);
+        detail::io::Decode(reader, count, v);
+    }
+    else
+    {
+        v.Reserve(count);
+        v.ResizeAndOverwrite(count, [&in](T* data, size_t n) {
+            detail::io::ReadAll(in, data, n * sizeof(T));
+            return n;
+        });
+    }
+}